@@ -45,6 +45,9 @@ const int has_llvm_engine = 1;
 
 int generate_llvm = 0;
 int execute_llvm = 0;
+int executing_llvm = 0;
+// If set, TBs have both TCG and LLVM code and this picks which one runs.
+bool (*llvm_exec_filter)(CPUState *cpu, TranslationBlock *tb) = NULL;
 extern bool panda_tb_chaining;
 
 extern bool panda_exit_loop;
@@ -191,7 +194,10 @@ static inline tcg_target_ulong cpu_tb_exec(CPUState *cpu, TranslationBlock *itb)
     panda_bb_invalidate_done = false;
 
 #if defined(CONFIG_LLVM)
-    if (execute_llvm) {
+    executing_llvm = execute_llvm && (cpu->panda_force_llvm ||
+            !llvm_exec_filter || llvm_exec_filter(cpu, itb));
+    cpu->panda_force_llvm = false;
+    if (executing_llvm) {
         assert(itb->llvm_tc_ptr);
         ret = tcg_llvm_qemu_tb_exec(env, itb);
     } else {
@@ -309,6 +315,7 @@ static void cpu_exec_step(CPUState *cpu)
         tcg_debug_assert(!have_mmap_lock());
 #endif
         tb_lock_reset();
+        cpu->panda_in_mem_watch = false;
     }
 }
 
@@ -432,9 +439,15 @@ static inline TranslationBlock *tb_find(CPUState *cpu,
         last_tb = NULL;
     }
 #endif
-    /* See if we can patch the calling TB. */
+    /* See if we can patch the calling TB. In replay, TBs translated with
+     * CF_RR_CHAIN_CHECK return to us before the next interrupt is due, but
+     * chained TBs skip the block callbacks, so plugins that use them (and
+     * replay breakpoints) keep chaining off. */
 #ifdef CONFIG_SOFTMMU
-    if (rr_mode != RR_REPLAY && panda_tb_chaining) { 
+    if (panda_tb_chaining && (rr_mode != RR_REPLAY
+            || ((tb->cflags & CF_RR_CHAIN_CHECK)
+                && !cpu->temp_rr_bp_instr
+                && !panda_block_callbacks_registered()))) {
 #endif
     if (last_tb && !qemu_loglevel_mask(CPU_LOG_TB_NOCHAIN)) {
         if (!have_tb_lock) {
@@ -783,6 +796,7 @@ int cpu_exec(CPUState *cpu)
 #endif /* buggy compiler */
         cpu->can_do_io = 1;
         tb_lock_reset();
+        cpu->panda_in_mem_watch = false;
     }
 
     /* if an exception is pending, we execute it here */
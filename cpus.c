@@ -1546,11 +1546,12 @@ void cpu_remove_sync(CPUState *cpu)
 /* For temporary buffers for forming a name */
 #define VCPU_THREAD_NAME_SIZE 16
 
+static QemuCond *tcg_halt_cond;
+static QemuThread *tcg_cpu_thread;
+
 static void qemu_tcg_init_vcpu(CPUState *cpu)
 {
     char thread_name[VCPU_THREAD_NAME_SIZE];
-    static QemuCond *tcg_halt_cond;
-    static QemuThread *tcg_cpu_thread;
 
     /* share a single thread for all cpus with TCG */
     if (!tcg_cpu_thread) {
@@ -1575,6 +1576,27 @@ static void qemu_tcg_init_vcpu(CPUState *cpu)
     }
 }
 
+/* After fork() only the calling thread survives, so the child must start
+ * a fresh TCG thread. The old halt condition may still count the dead
+ * thread as a waiter, so it is not reused either. Called with the iothread
+ * lock held and all vcpus paused.
+ */
+void qemu_tcg_vcpus_after_fork(void)
+{
+    CPUState *cpu;
+
+    assert(tcg_enabled());
+    tcg_cpu_thread = NULL;
+    tcg_halt_cond = NULL;
+    CPU_FOREACH(cpu) {
+        cpu->created = false;
+        cpu->thread_kicked = false;
+    }
+    CPU_FOREACH(cpu) {
+        qemu_tcg_init_vcpu(cpu);
+    }
+}
+
 static void qemu_hax_start_vcpu(CPUState *cpu)
 {
     char thread_name[VCPU_THREAD_NAME_SIZE];
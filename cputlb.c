@@ -35,6 +35,7 @@
 #include "panda/rr/rr_log_all.h"
 #include "panda/rr/rr_log.h"
 #include "panda/callback_support.h"
+#include "panda/common.h"
 
 /* DEBUG defines, enable DEBUG_TLB_LOG to log to the CPU_LOG_MMU target */
 /* #define DEBUG_TLB */
@@ -122,6 +123,7 @@ static void tlb_flush_nocheck(CPUState *cpu)
     memset(env->tlb_table, -1, sizeof(env->tlb_table));
     memset(env->tlb_v_table, -1, sizeof(env->tlb_v_table));
     memset(cpu->tb_jmp_cache, 0, sizeof(cpu->tb_jmp_cache));
+    panda_vcache_flush();
 
     env->vtlb_index = 0;
     env->tlb_flush_addr = -1;
@@ -187,6 +189,7 @@ static void tlb_flush_by_mmuidx_async_work(CPUState *cpu, run_on_cpu_data data)
     }
 
     memset(cpu->tb_jmp_cache, 0, sizeof(cpu->tb_jmp_cache));
+    panda_vcache_flush();
 
     tlb_debug("done\n");
 
@@ -285,6 +288,7 @@ static void tlb_flush_page_async_work(CPUState *cpu, run_on_cpu_data data)
     }
 
     tb_flush_jmp_cache(cpu, addr);
+    panda_vcache_flush();
 }
 
 void tlb_flush_page(CPUState *cpu, target_ulong addr)
@@ -332,6 +336,7 @@ static void tlb_flush_page_by_mmuidx_async_work(CPUState *cpu,
     }
 
     tb_flush_jmp_cache(cpu, addr);
+    panda_vcache_flush();
 }
 
 static void tlb_check_page_and_flush_by_mmuidx_async_work(CPUState *cpu,
@@ -543,8 +548,9 @@ void tlb_reset_dirty(CPUState *cpu, ram_addr_t start1, ram_addr_t length)
 
 static inline void tlb_set_dirty1(CPUTLBEntry *tlb_entry, target_ulong vaddr)
 {
-    if (tlb_entry->addr_write == (vaddr | TLB_NOTDIRTY)) {
-        tlb_entry->addr_write = vaddr;
+    /* PANDA: keep the watch flag, if any */
+    if ((tlb_entry->addr_write & ~TLB_PANDA_WATCH) == (vaddr | TLB_NOTDIRTY)) {
+        tlb_entry->addr_write &= ~TLB_NOTDIRTY;
     }
 }
 
@@ -616,6 +622,7 @@ void tlb_set_page_with_attrs(CPUState *cpu, target_ulong vaddr,
     hwaddr iotlb, xlat, sz;
     unsigned vidx = env->vtlb_index++ % CPU_VTLB_SIZE;
     int asidx = cpu_asidx_from_attrs(cpu, attrs);
+    bool watch_read, watch_write;
 
     assert_cpu_is_self(cpu);
     assert(size >= TARGET_PAGE_SIZE);
@@ -688,6 +695,15 @@ void tlb_set_page_with_attrs(CPUState *cpu, target_ulong vaddr,
         }
     }
 
+    /* PANDA: accesses to watched ranges have to take the slow path */
+    panda_mem_watch_page(cpu, vaddr, paddr, &watch_read, &watch_write);
+    if (watch_read && tn.addr_read != -1) {
+        tn.addr_read |= TLB_PANDA_WATCH;
+    }
+    if (watch_write && tn.addr_write != -1) {
+        tn.addr_write |= TLB_PANDA_WATCH;
+    }
+
     /* Pairs with flag setting in tlb_reset_dirty_range */
     copy_tlb_helper(te, &tn, true);
     /* atomic_mb_set(&te->addr_write, write_address); */
@@ -551,6 +551,25 @@ static inline bool aio_context_in_iothread(AioContext *ctx)
  */
 void aio_context_setup(AioContext *ctx);
 
+/**
+ * aio_context_forget_epoll:
+ * @ctx: the aio context
+ *
+ * Stop using the epoll instance of @ctx, if any, and poll with ppoll().
+ */
+void aio_context_forget_epoll(AioContext *ctx);
+
+/**
+ * aio_context_after_fork:
+ * @ctx: the aio context
+ *
+ * In a child process created by fork(), give @ctx an event notifier and
+ * poll state of its own rather than sharing the parent's, and drop its
+ * thread pool, whose worker threads did not survive the fork.  The parent
+ * must have drained all I/O before forking.
+ */
+void aio_context_after_fork(AioContext *ctx);
+
 /**
  * aio_context_set_poll_params:
  * @ctx: the aio context
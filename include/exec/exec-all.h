@@ -350,6 +350,8 @@ struct TranslationBlock {
 #define CF_NOCACHE     0x10000 /* To be freed after execution */
 #define CF_USE_ICOUNT  0x20000
 #define CF_IGNORE_ICOUNT 0x40000 /* Do not generate icount code */
+#define CF_RR_CHAIN_CHECK 0x80000 /* Exit if the TB would run past
+                                     cpu->rr_chain_limit (replay) */
 
     uint16_t invalid;
 
@@ -565,6 +567,9 @@ extern bool exit_request;
 
 extern int generate_llvm;
 extern int execute_llvm;
+/* Whether the TB running now (or last) is the LLVM version. */
+extern int executing_llvm;
+extern bool (*llvm_exec_filter)(CPUState *cpu, TranslationBlock *tb);
 extern const int has_llvm_engine;
 
 #endif
@@ -6,6 +6,7 @@
 /* Helpers for instruction counting code generation.  */
 
 static int icount_start_insn_idx;
+static int rr_chain_insn_idx;
 static TCGLabel *icount_label;
 static TCGLabel *exitreq_label;
 
@@ -20,6 +21,29 @@ static inline void gen_tb_start(TranslationBlock *tb)
     tcg_gen_brcondi_i32(TCG_COND_NE, flag, 0, exitreq_label);
     tcg_temp_free_i32(flag);
 
+    if (tb->cflags & CF_RR_CHAIN_CHECK) {
+        /* Replay: leave the chain unless the whole TB ends at or before
+         * the next interrupt, so that cpu_exec gets to deliver it. The sum
+         * is only compared with rr_chain_limit, never stored: the count is
+         * still advanced per instruction by gen_op_update_rr_icount. */
+        TCGv_i64 rr_count = tcg_temp_new_i64();
+        TCGv_i64 rr_limit = tcg_temp_new_i64();
+        TCGv_i32 rr_insns = tcg_temp_new_i32();
+        tcg_gen_ld_i64(rr_count, cpu_env,
+                       -ENV_OFFSET + offsetof(CPUState, rr_guest_instr_count));
+        /* patched with the insn count in gen_tb_end, as for icount */
+        rr_chain_insn_idx = tcg_op_buf_count();
+        tcg_gen_movi_i32(rr_insns, 0xdeadbeef);
+        tcg_gen_extu_i32_i64(rr_limit, rr_insns);
+        tcg_gen_add_i64(rr_count, rr_count, rr_limit);
+        tcg_gen_ld_i64(rr_limit, cpu_env,
+                       -ENV_OFFSET + offsetof(CPUState, rr_chain_limit));
+        tcg_gen_brcond_i64(TCG_COND_GTU, rr_count, rr_limit, exitreq_label);
+        tcg_temp_free_i32(rr_insns);
+        tcg_temp_free_i64(rr_limit);
+        tcg_temp_free_i64(rr_count);
+    }
+
     if (!(tb->cflags & CF_USE_ICOUNT)) {
         return;
     }
@@ -50,6 +74,10 @@ static void gen_tb_end(TranslationBlock *tb, int num_insns)
     gen_set_label(exitreq_label);
     tcg_gen_exit_tb((uintptr_t)tb + TB_EXIT_REQUESTED);
 
+    if (tb->cflags & CF_RR_CHAIN_CHECK) {
+        tcg_set_insn_param(rr_chain_insn_idx, 1, num_insns);
+    }
+
     if (tb->cflags & CF_USE_ICOUNT) {
         /* Update the num_insn immediate parameter now that we know
          * the actual insn count.  */
@@ -1621,6 +1621,9 @@ MemTxResult address_space_read_continue(AddressSpace *as, hwaddr addr,
 MemTxResult address_space_read_full(AddressSpace *as, hwaddr addr,
                                     MemTxAttrs attrs, uint8_t *buf, int len);
 void *qemu_map_ram_ptr(RAMBlock *ram_block, ram_addr_t addr);
+/* Invalidate TBs on and mark dirty a range of RAM region @mr that was
+ * written through its host pointer.  */
+void invalidate_and_set_dirty(MemoryRegion *mr, hwaddr addr, hwaddr length);
 
 static inline bool memory_access_is_direct(MemoryRegion *mr, bool is_write)
 {
@@ -370,6 +370,8 @@ size_t ram_control_save_page(QEMUFile *f, ram_addr_t block_offset,
                              uint64_t *bytes_sent);
 
 void ram_mig_init(void);
+/* When set, savevm leaves guest RAM out of the stream. */
+extern bool ram_state_external;
 void savevm_skip_section_footers(void);
 void register_global_state(void);
 void global_state_set_optional(void);
@@ -44,6 +44,13 @@
  */
 int qemu_init_main_loop(Error **errp);
 
+/**
+ * qemu_main_loop_after_fork: Give a child process created by fork() main
+ * loop notifiers of its own, so that it and its parent do not wake or
+ * swallow each other's events.  Call with the iothread lock held.
+ */
+void qemu_main_loop_after_fork(void);
+
 /**
  * main_loop_wait: Run one iteration of the main loop.
  *
@@ -391,7 +391,18 @@ struct CPUState {
     uint32_t can_do_io;
     int32_t exception_index; /* used by m68k TCG */
     uint64_t rr_guest_instr_count;
+    /* In replay, chained TBs return to cpu_exec rather than run past this
+     * instruction count, which is where the next interrupt is due. */
+    uint64_t rr_chain_limit;
     uint64_t panda_guest_pc;
+    /* Set while performing an access that has already been reported to
+     * the range-watching memory callbacks. */
+    bool panda_in_mem_watch;
+    /* Host return address of the guest memory access being reported to
+     * the memory callbacks, so that they can restart the instruction. */
+    uintptr_t panda_mem_retaddr;
+    /* Run the next TB as LLVM code even if it has TCG code too. */
+    bool panda_force_llvm;
 
     // Used for rr reverse debugging
     uint8_t reverse_flags;
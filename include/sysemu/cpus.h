@@ -9,6 +9,7 @@ void qemu_init_cpu_loop(void);
 void resume_all_vcpus(void);
 void pause_all_vcpus(void);
 void cpu_stop_current(void);
+void qemu_tcg_vcpus_after_fork(void);
 void cpu_ticks_init(void);
 
 void configure_icount(QemuOpts *opts, Error **errp);
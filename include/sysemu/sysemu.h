@@ -131,6 +131,8 @@ void qemu_savevm_send_postcopy_ram_discard(QEMUFile *f, const char *name,
 
 int qemu_loadvm_state(QEMUFile *f);
 int qemu_savevm_state(QEMUFile *f, Error **errp);
+/* Save all non-RAM device state; loadable with qemu_loadvm_state() */
+int qemu_save_device_state(QEMUFile *f);
 
 extern int autostart;
 
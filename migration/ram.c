@@ -2660,6 +2660,14 @@ static int ram_load(QEMUFile *f, void *opaque, int version_id)
     return ret;
 }
 
+/* PANDA: record/replay snapshots write guest RAM themselves. */
+bool ram_state_external;
+
+static bool ram_is_active(void *opaque)
+{
+    return !ram_state_external;
+}
+
 static SaveVMHandlers savevm_ram_handlers = {
     .save_live_setup = ram_save_setup,
     .save_live_iterate = ram_save_iterate,
@@ -2668,6 +2676,7 @@ static SaveVMHandlers savevm_ram_handlers = {
     .save_live_pending = ram_save_pending,
     .load_state = ram_load,
     .cleanup = ram_migration_cleanup,
+    .is_active = ram_is_active,
 };
 
 void ram_mig_init(void)
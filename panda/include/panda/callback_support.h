@@ -13,6 +13,8 @@ void panda_callbacks_after_block_exec(CPUState *cpu, TranslationBlock *tb, uint8
 void panda_callbacks_before_block_translate(CPUState *cpu, target_ulong pc);
 void panda_callbacks_after_block_translate(CPUState *cpu, TranslationBlock *tb);
 bool panda_callbacks_after_find_fast(CPUState *cpu, TranslationBlock *tb, bool panda_bb_invalidate_done, bool *invalidate);
+// true if a plugin wants block-level exec callbacks, which chained TBs skip
+bool panda_block_callbacks_registered(void);
 void panda_callbacks_after_cpu_exec_enter(CPUState *cpu);
 void panda_callbacks_before_cpu_exec_exit(CPUState *cpu, bool ranBlock);
 
@@ -28,7 +30,13 @@ void panda_callbacks_before_mem_write(CPUState *env, target_ulong pc, target_ulo
                                       uint32_t data_size, uint64_t result, void *ram_ptr);
 void panda_callbacks_after_mem_write(CPUState *env, target_ulong pc, target_ulong addr,
                                      uint32_t data_size, uint64_t val, void *ram_ptr);
+// softmmu_template.h, for pages with TLB_PANDA_WATCH set
+void panda_callbacks_mem_watch(CPUState *cpu, bool is_write, bool after,
+                               target_ulong addr, uint32_t data_size,
+                               uint64_t val, void *ram_ptr);
 // cputlb.c
+void panda_mem_watch_page(CPUState *cpu, target_ulong vaddr, hwaddr paddr,
+                          bool *read, bool *write);
 void panda_callbacks_after_mmio_read(CPUState *env, target_ulong addr, int size, uint64_t val);
 void panda_callbacks_after_mmio_write(CPUState *env, target_ulong addr, int size, uint64_t val);
 
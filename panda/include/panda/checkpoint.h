@@ -1,5 +1,8 @@
 #include "panda/rr/rr_log.h"
 
+// A deduplicated guest RAM page, shared between incremental checkpoints.
+typedef struct CheckpointPage CheckpointPage;
+
 typedef struct Checkpoint {
     uint64_t guest_instr_count;
     size_t nondet_log_position;
@@ -10,20 +13,50 @@ typedef struct Checkpoint {
 
     unsigned next_progress;
 
+    // Full checkpoints hold a complete savevm image here. Incremental ones
+    // only hold the non-RAM device state.
     int memfd;
 
     size_t memfd_usage;
 
+    // Incremental checkpoints: the RAM pages dirtied since parent was taken
+    // (or restored). A checkpoint with no parent holds every page.
+    bool incremental;
+    struct Checkpoint *parent;
+    size_t num_pages;
+    uint64_t *page_addrs; // ram_addr_t of each saved page
+    CheckpointPage **pages;
+
+    // Fork checkpoints (memfd < 0): the child parked at this checkpoint, and
+    // the write end of its command pipe.
+    pid_t fork_pid;
+    int fork_pipe;
+
     QLIST_ENTRY(Checkpoint) next;
 } Checkpoint;
 
-#define MAX_CHECKPOINTS 256
+#define MAX_CHECKPOINTS 1024
 extern Checkpoint* checkpoints[MAX_CHECKPOINTS];
+// Take incremental (dirty-page delta) checkpoints rather than full savevm
+// images. Off by default. Must be set before the first checkpoint is taken.
+extern bool checkpoint_incremental;
+// Take checkpoints by forking the replaying process instead. Takes
+// precedence over checkpoint_incremental.
+extern bool checkpoint_fork;
 
 /*void* search_checkpoints(uint64_t target_instr);*/
 size_t get_num_checkpoints(void);
+// Total bytes held by all checkpoints, including the shared page store.
+size_t get_checkpoint_usage(void);
 int get_closest_checkpoint_num(uint64_t instr_count);
 Checkpoint* get_checkpoint(int num);
 void* panda_checkpoint(void);
 void panda_restore_by_num(int num);
 void panda_restore(void *opaque);
+// Fork checkpoints only: replay from checkpoint in a new process, up to
+// stop_instr_count (0 for the whole replay), while the caller continues.
+int panda_checkpoint_spawn(Checkpoint *checkpoint, uint64_t stop_instr_count);
+// Fork checkpoints only: called in each resumed process before it replays.
+void panda_checkpoint_set_resume_hook(void (*hook)(Checkpoint *checkpoint,
+        uint64_t stop_instr_count));
+void panda_checkpoint_do_fork(void);
@@ -65,6 +65,7 @@ static inline int panda_physical_memory_rw(hwaddr addr, uint8_t *buf, int len,
 
     if (is_write) {
         memcpy(ram_ptr, buf, len);
+        invalidate_and_set_dirty(mr, addr1, len);
     } else {
         memcpy(buf, ram_ptr, len);
     }
@@ -87,6 +88,80 @@ static inline hwaddr panda_virt_to_phys(CPUState *env, target_ulong addr) {
     return phys_addr;
 }
 
+/*
+ * Virtual to host translation cache.
+ *
+ * Plugins mostly read guest memory in small pieces (a pointer, a pid, a
+ * syscall argument), and walking the guest page tables dominates the cost
+ * of such reads. panda_virtual_memory_rw() therefore first looks the page
+ * up in the vCPU's softmmu TLB and then, for reads, in a small
+ * direct-mapped cache of RAM pages, keyed by (page table base, virtual
+ * page). The cache is flushed along with the softmmu TLB, which includes
+ * every CR3 write on i386. Writes that miss the TLB take the physical
+ * memory path, which invalidates TBs on the page and marks it dirty.
+ */
+#define PANDA_VCACHE_BITS 9
+#define PANDA_VCACHE_SIZE (1 << PANDA_VCACHE_BITS)
+
+typedef struct {
+    uint64_t generation;    // valid if equal to panda_vcache_generation
+    uint64_t asid;
+    target_ulong page;
+    uint8_t *host;          // host address of the start of the page
+} PandaVCacheEntry;
+
+extern PandaVCacheEntry panda_vcache[PANDA_VCACHE_SIZE];
+extern uint64_t panda_vcache_generation;
+
+void panda_vcache_flush(void);
+uint8_t *panda_vcache_fill(CPUState *env, target_ulong page);
+
+/**
+ * @brief Page table base that cached translations are keyed on. Unlike
+ * panda_current_asid() this is just a register read.
+ */
+static inline uint64_t panda_vcache_asid(CPUState *env) {
+    CPUArchState *cenv = (CPUArchState *)env->env_ptr;
+#if defined(TARGET_I386)
+    return cenv->cr[3];
+#elif defined(TARGET_ARM)
+    // 32-bit TTBR writes don't flush the TLB, so this key matters on ARM.
+    return cenv->cp15.ttbr0_el[1];
+#elif defined(TARGET_PPC)
+    return cenv->sr[0];
+#else
+#error "panda_vcache_asid() not implemented for target architecture."
+    return 0;
+#endif
+}
+
+/**
+ * @brief Returns the host address of guest virtual page \p page if it is
+ * plain RAM that can be accessed directly, or NULL.
+ */
+static inline uint8_t *panda_virt_page_to_host(CPUState *env, target_ulong page,
+                                               bool is_write) {
+    CPUArchState *cenv = (CPUArchState *)env->env_ptr;
+    int mmu_idx = cpu_mmu_index(cenv, false);
+    CPUTLBEntry *te = &cenv->tlb_table[mmu_idx][(page >> TARGET_PAGE_BITS) & (CPU_TLB_SIZE - 1)];
+    // An exact match means no flags: valid, not MMIO, and (for writes)
+    // not tracking dirtiness.
+    if ((is_write ? te->addr_write : te->addr_read) == page) {
+        return (uint8_t *)(page + te->addend);
+    }
+    if (is_write) {
+        // a direct store would skip invalidate_and_set_dirty()
+        return NULL;
+    }
+
+    PandaVCacheEntry *e = &panda_vcache[(page >> TARGET_PAGE_BITS) & (PANDA_VCACHE_SIZE - 1)];
+    if (e->generation == panda_vcache_generation && e->page == page &&
+            e->asid == panda_vcache_asid(env)) {
+        return e->host;
+    }
+    return panda_vcache_fill(env, page);
+}
+
 /**
  * @brief Reads/writes data into/from \p buf from/to guest virtual address \p addr.
  */
@@ -96,22 +171,34 @@ static inline int panda_virtual_memory_rw(CPUState *env, target_ulong addr,
     int ret;
     hwaddr phys_addr;
     target_ulong page;
+    uint8_t *host;
 
     while (len > 0) {
         page = addr & TARGET_PAGE_MASK;
-        phys_addr = cpu_get_phys_page_debug(env, page);
-        if (phys_addr == -1) {
-            // no physical page mapped
-            return -1;
-        }
         l = (page + TARGET_PAGE_SIZE) - addr;
         if (l > len) {
             l = len;
         }
-        phys_addr += (addr & ~TARGET_PAGE_MASK);
-        ret = panda_physical_memory_rw(phys_addr, buf, l, is_write);
-        if (ret != MEMTX_OK) {
-            return ret;
+        host = panda_virt_page_to_host(env, page, is_write);
+        if (likely(host != NULL)) {
+            host += addr & ~TARGET_PAGE_MASK;
+            if (is_write) {
+                memcpy(host, buf, l);
+            } else {
+                memcpy(buf, host, l);
+            }
+        } else {
+            // unmapped, or not RAM
+            phys_addr = cpu_get_phys_page_debug(env, page);
+            if (phys_addr == -1) {
+                // no physical page mapped
+                return -1;
+            }
+            phys_addr += (addr & ~TARGET_PAGE_MASK);
+            ret = panda_physical_memory_rw(phys_addr, buf, l, is_write);
+            if (ret != MEMTX_OK) {
+                return ret;
+            }
         }
         len -= l;
         buf += l;
@@ -120,6 +207,48 @@ static inline int panda_virtual_memory_rw(CPUState *env, target_ulong addr,
     return 0;
 }
 
+/**
+ * @brief Reads a guest-endian 32-bit value from guest virtual address
+ * \p addr into \p val. Returns 0 on success, like panda_virtual_memory_rw().
+ */
+static inline int panda_virtual_read_u32(CPUState *env, target_ulong addr,
+                                         uint32_t *val) {
+    uint8_t buf[4];
+    if (likely((addr & ~TARGET_PAGE_MASK) <= TARGET_PAGE_SIZE - sizeof(buf))) {
+        uint8_t *host = panda_virt_page_to_host(env, addr & TARGET_PAGE_MASK, false);
+        if (likely(host != NULL)) {
+            *val = ldl_p(host + (addr & ~TARGET_PAGE_MASK));
+            return 0;
+        }
+    }
+    int ret = panda_virtual_memory_rw(env, addr, buf, sizeof(buf), false);
+    if (ret == 0) {
+        *val = ldl_p(buf);
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads a guest-endian 64-bit value from guest virtual address
+ * \p addr into \p val. Returns 0 on success, like panda_virtual_memory_rw().
+ */
+static inline int panda_virtual_read_u64(CPUState *env, target_ulong addr,
+                                         uint64_t *val) {
+    uint8_t buf[8];
+    if (likely((addr & ~TARGET_PAGE_MASK) <= TARGET_PAGE_SIZE - sizeof(buf))) {
+        uint8_t *host = panda_virt_page_to_host(env, addr & TARGET_PAGE_MASK, false);
+        if (likely(host != NULL)) {
+            *val = ldq_p(host + (addr & ~TARGET_PAGE_MASK));
+            return 0;
+        }
+    }
+    int ret = panda_virtual_memory_rw(env, addr, buf, sizeof(buf), false);
+    if (ret == 0) {
+        *val = ldq_p(buf);
+    }
+    return ret;
+}
+
 /**
  * @brief Reads data into \p buf from guest virtual address \p addr.
  */
@@ -19,17 +19,17 @@ PANDAENDCOMMENT */
 
 void helper_panda_insn_exec(target_ulong pc) {
     // PANDA instrumentation: before basic block
-    panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_INSN_EXEC]; plist != NULL; plist = panda_cb_list_next(plist)) {
-        plist->entry.insn_exec(first_cpu, pc);
+    panda_cb_table *t = &panda_cb_tables[PANDA_CB_INSN_EXEC];
+    for (int i = 0; i < t->n; i++) {
+        t->cbs[i].insn_exec(first_cpu, pc);
     }
 }
 
 void helper_panda_after_insn_exec(target_ulong pc) {
     // PANDA instrumentation: after basic block
-    panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_AFTER_INSN_EXEC]; plist != NULL; plist = panda_cb_list_next(plist)) {
-        plist->entry.after_insn_exec(first_cpu, pc);
+    panda_cb_table *t = &panda_cb_tables[PANDA_CB_AFTER_INSN_EXEC];
+    for (int i = 0; i < t->n; i++) {
+        t->cbs[i].after_insn_exec(first_cpu, pc);
     }
 }
 
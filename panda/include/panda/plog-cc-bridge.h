@@ -5,6 +5,9 @@
  *
  */
 
+#include <stdbool.h>
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -14,6 +17,10 @@ void pandalog_init(const char *fname);
 // Closes global C++ pandalog in common.c
 void pandalog_cc_close(void);
 
+// Write out queued chunks and stop the compressor threads, e.g. before
+// fork(). They are started again when the next chunk fills up.
+void pandalog_cc_stop_threads(void);
+
 //Interface for plog.c to pass a packed protobuf entry to C++ pandalog
 void pandalog_write_packed(size_t entry_size, unsigned char* buf);
 
@@ -29,6 +36,9 @@ void pandalog_cc_init_read_bwd(const char* path);
 //Open C++ pandalog for write
 void pandalog_cc_init_write(const char* path);
 
+// Select the chunk codec for writing: "zlib", "zlib:<level>" or "none"
+bool pandalog_cc_set_codec(const char *spec);
+
 //Seek to an instr
 void pandalog_cc_seek(uint64_t instr);
 
@@ -24,11 +24,18 @@ extern "C" {
 #include <iostream>
 #include <memory>
 #include <stdint.h>
+#include <vector>
 #include "plog.pb.h"
 
-#define PL_CURRENT_VERSION 2
-// compression level
-#define PL_Z_LEVEL 9
+// version 3 adds the codec to the header
+#define PL_CURRENT_VERSION 3
+// chunk codecs. version 2 logs are always PL_CODEC_ZLIB.
+#define PL_CODEC_ZLIB 0
+#define PL_CODEC_NONE 1
+// default compression level for PL_CODEC_ZLIB
+#define PL_Z_LEVEL Z_BEST_SPEED
+// chunks are compressed and written out by this many background threads
+#define PL_COMPRESS_THREADS 4
 // 16 MB chunk
 #define PL_CHUNKSIZE (1024 * 1024 * 16)
 // header at most this many bytes
@@ -39,6 +46,7 @@ typedef struct pandalog_header_struct {
     uint32_t version;     // version number
     uint64_t dir_pos;     // position in file of directory
     uint32_t chunk_size;  // chunk size
+    uint32_t codec;       // chunk codec (version 3 and later)
 } PlHeader;
 
 // directory mapping instructions to chunks in the outfile
@@ -65,6 +73,7 @@ struct PandalogCcChunk {
     uint32_t zsize;             // in bytes of a compressed chunk. 
     unsigned char *buf;         // uncompressed chunk data
     unsigned char *buf_p;       // pointer into uncompressed chunk (used while writing)
+    uint32_t buf_cap;           // allocated size of buf, may exceed size
     unsigned char *zbuf;        // corresponding compressed chunk
     // these are used while writing to remember things needed for dir entry
     uint32_t start_instr;       // first instruction in current chunk 
@@ -76,6 +85,9 @@ struct PandalogCcChunk {
     uint32_t ind_entry;         // index into array of entries
 };
 
+// background compressor state, see plog-cc.cpp
+struct PandalogCcWriter;
+
 class PandaLog {
     PlMode mode;
     const char *filename;
@@ -83,12 +95,18 @@ class PandaLog {
     PandalogCcDir dir;
     PandalogCcChunk chunk;
     uint32_t chunk_num;
+    uint32_t codec;
+    int z_level;
+    PandalogCcWriter *writer;
 
 public:    
     //default constructor
     PandaLog(): mode(PL_MODE_UNKNOWN){
         mode = PL_MODE_UNKNOWN;
         chunk_num = 0;
+        codec = PL_CODEC_ZLIB;
+        z_level = PL_Z_LEVEL;
+        writer = NULL;
     };
 
     // open pandalog for write with this uncompressed chunk size
@@ -109,6 +127,10 @@ public:
 
     void write_entry(std::unique_ptr<panda::LogEntry> entry);
 
+    // select the chunk codec ("zlib", "zlib:<level>" or "none").
+    // only valid before the first chunk is written.
+    bool set_codec(const char *spec);
+
     std::unique_ptr<panda::LogEntry> read_entry(void);
 
     // seek to the element in pandalog corresponding to this instr
@@ -117,6 +139,10 @@ public:
     // if PL_MODE_READ_BWD then we seek to LAST element in log for this instr
     void seek(uint64_t instr);
 
+    // writes out queued chunks and stops the compressor threads, which
+    // start again with the next chunk. e.g. before fork()
+    void quiesce();
+
 private: 
     //initializes some fields in the pandalog
     void create(uint32_t chunk_size);
@@ -136,12 +162,16 @@ private:
     // decompresses chunk and reads all entries into vector
     void unmarshall_chunk(uint32_t chunk_num);
 
-    // Adds directory entry to list of directory entries. Does not write to log
-    void add_dir_entry();
-
-    //Zlib compresses and writes current chunk to log
+    // hands the current chunk to the compressor threads, which write it
+    // to the log in order
     void write_current_chunk();
 
+    // compressor thread main loop
+    void compress_chunks();
+
+    // waits for all chunks to be written and stops the compressor threads
+    void stop_writer();
+
     // Finds index of entry with this instr number
     uint32_t find_ind(uint64_t instr, uint32_t lo, uint32_t high);
 
@@ -714,9 +714,30 @@ struct _panda_cb_list {
     bool enabled;
 };
 panda_cb_list* panda_cb_list_next(panda_cb_list* plist);
+
+// The enabled callbacks of one type, in registration order. These are
+// compiled from the lists in panda_cbs whenever a callback is registered,
+// enabled, disabled or unregistered, so dispatching is a walk over an array.
+typedef struct panda_cb_table {
+    panda_cb *cbs;
+    int n;
+    int cap;
+} panda_cb_table;
 void panda_enable_plugin(void *plugin);
 void panda_disable_plugin(void *plugin);
 
+// A memory callback that only sees accesses overlapping [start, end), see
+// panda_register_mem_range_callback.
+typedef struct panda_mem_range {
+    panda_cb cb;
+    void *owner;
+    panda_cb_type type;
+    uint64_t start;
+    uint64_t end;
+    target_ulong asid;  // 0 for any address space
+    bool in_use;
+} panda_mem_range;
+
 // Structure to store metadata about a plugin
 typedef struct panda_plugin {
     char name[256];     // Currently basename(filename)
@@ -727,6 +748,9 @@ void   panda_register_callback(void *plugin, panda_cb_type type, panda_cb cb);
 void   panda_disable_callback(void *plugin, panda_cb_type type, panda_cb cb);
 void   panda_enable_callback(void *plugin, panda_cb_type type, panda_cb cb);
 void   panda_unregister_callbacks(void *plugin);
+int    panda_register_mem_range_callback(void *plugin, panda_cb_type type, panda_cb cb,
+                                         uint64_t start, uint64_t len, target_ulong asid);
+void   panda_unregister_mem_range_callback(int id);
 bool   panda_load_plugin(const char *filename, const char *plugin_name);
 bool   panda_add_arg(const char *plugin_name, const char *plugin_arg);
 void * panda_get_plugin_by_name(const char *name);
@@ -745,6 +769,17 @@ void panda_enable_memcb(void);
 void panda_disable_memcb(void);
 void panda_enable_llvm(void);
 void panda_disable_llvm(void);
+void panda_set_llvm_exec_filter(bool (*filter)(CPUState *cpu, TranslationBlock *tb));
+// Abandon the TB running as TCG code and run the current guest instruction
+// again as LLVM code. Only valid from a before-memory-access callback while
+// LLVM is enabled. The instruction's count is taken back, so instruction
+// counts stay correct, but callbacks that already ran for the instruction
+// run again: insn_exec, and the memory callbacks of every access it made
+// before this one (including, for the plugins that precede the caller, the
+// before callbacks of this access). The new TB's block callbacks also run.
+// Plugins used together with one that restarts (e.g. taint2) must tolerate
+// seeing these events twice.
+void panda_restart_in_llvm(CPUState *cpu);
 void panda_enable_llvm_helpers(void);
 void panda_disable_llvm_helpers(void);
 void panda_enable_tb_chaining(void);
@@ -754,6 +789,14 @@ void panda_memsavep(FILE *f);
 extern bool panda_update_pc;
 extern bool panda_use_memcb;
 extern panda_cb_list *panda_cbs[PANDA_CB_LAST];
+extern panda_cb_table panda_cb_tables[PANDA_CB_LAST];
+extern panda_mem_range *panda_mem_ranges;
+extern int panda_num_mem_ranges;
+
+// Cheap enough to ask at translation time, e.g. before emitting a helper call.
+static inline bool panda_has_callbacks(panda_cb_type type) {
+    return panda_cb_tables[type].n > 0;
+}
 extern bool panda_plugins_to_unload[MAX_PANDA_PLUGINS];
 extern bool panda_plugin_to_unload;
 extern bool panda_tb_chaining;
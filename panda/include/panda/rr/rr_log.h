@@ -14,6 +14,7 @@
 #include "panda/cheaders.h"
 #endif
 #include "panda/rr/rr_log_all.h"
+#include "panda/rr/rr_log_block.h"
 
 // accessors
 uint64_t rr_get_pc(void);
@@ -100,6 +101,8 @@ typedef struct {
     } variant;
     // mz XXX HACK
     uint64_t old_buf_addr;
+    // replay only: read-ahead arena position just past this entry's buffer
+    uint64_t arena_pos;
 } RR_skipped_call_args;
 
 // an item in a program-point indexed record/replay log
@@ -145,6 +148,11 @@ typedef struct RR_log_t {
     unsigned long long
         size; // for a log being opened for read, this will be the size in bytes
     uint64_t bytes_read;
+
+    // set for block-compressed (v2) logs; size and bytes_read are then
+    // offsets into the uncompressed entry stream.
+    RR_block_writer* writer;
+    RR_block_reader* reader;
 } RR_log;
 
 RR_log_entry* rr_get_queue_head(void);
@@ -190,8 +198,9 @@ static inline void rr_maybe_progress(void) {
 
 extern void rr_fill_queue(void);
 extern RR_log_entry *rr_queue_tail;
-static inline uint64_t rr_num_instr_before_next_interrupt(void) {
-    if (!rr_queue_tail) rr_fill_queue();
+// Instruction count at which the queued entries next need cpu_exec to
+// regain control, or -1 if they don't.
+static inline uint64_t rr_next_interrupt_instr_count(void) {
     if (!rr_queue_tail) return -1;
 
     RR_header last_header = rr_queue_tail->header;
@@ -203,16 +212,30 @@ static inline uint64_t rr_num_instr_before_next_interrupt(void) {
         case RR_LAST:
         case RR_END_OF_LOG:
         case RR_INTERRUPT_REQUEST:
-            return last_header.prog_point.guest_instr_count -
-                rr_get_guest_instr_count();
+            return last_header.prog_point.guest_instr_count;
         default:
             return -1;
     }
 }
 
+// Recompute first_cpu->rr_chain_limit, which bounds TB chaining in replay.
+void rr_update_chain_limit(void);
+
+static inline uint64_t rr_num_instr_before_next_interrupt(void) {
+    if (!rr_queue_tail) rr_fill_queue();
+
+    uint64_t next = rr_next_interrupt_instr_count();
+    if (next == (uint64_t)-1) return -1;
+    return next - rr_get_guest_instr_count();
+}
+
 uint32_t rr_checksum_memory(void);
 uint32_t rr_checksum_regs(void);
 
 bool rr_queue_empty(void);
 
+// Discard everything decoded so far and resume reading the replay log at pos.
+void rr_nondet_log_seek(uint64_t pos);
+void rr_nondet_log_reopen_after_fork(void);
+
 #endif
@@ -60,6 +60,11 @@ extern volatile int rr_end_record_requested;
 extern volatile int rr_end_replay_requested;
 extern char* rr_requested_name;
 extern char* rr_snapshot_name;
+// write block-compressed, indexed (v2) nondet logs when recording
+extern bool rr_log_compress;
+// write guest RAM into the start snapshot while the guest keeps running
+extern bool rr_snapshot_background;
+extern uint64_t rr_replay_stop_instr_count;
 
 // used from monitor.c
 int rr_do_begin_record(const char* name, CPUState* cpu_state);
@@ -0,0 +1,99 @@
+#ifndef __RR_LOG_BLOCK_H_
+#define __RR_LOG_BLOCK_H_
+
+/* Block-compressed (v2) nondet log format.
+
+   The v1 log is a raw stream of packed entries preceded by the final
+   guest instruction count. A v2 log carries the same entry stream, but
+   split into independently zlib-compressed blocks, each holding whole
+   entries, followed by an index of (first guest_instr_count, file offset,
+   stream offset) per block:
+
+     RR_log_v2_header
+     { uint32_t compressed_len; uint32_t raw_len; data[compressed_len] } *
+     RR_block_index_entry[num_blocks]
+
+   All positions handed out by the reader (and stored in
+   RR_header.file_pos) are offsets into the uncompressed entry stream, so
+   the rest of the record/replay code is unaware of the compression.
+*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// "PDRRLOG2" read as a little-endian uint64. This can never be a plausible
+// instruction count, which is what a v1 log starts with.
+#define RR_LOG_V2_MAGIC 0x32474f4c52524450ULL
+#define RR_LOG_V2_VERSION 2
+#define RR_LOG_BLOCK_SIZE (1 << 20)
+
+typedef struct {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t block_size;
+    uint64_t last_instr_count;
+    uint64_t index_offset;
+    uint64_t num_blocks;
+    uint64_t stream_size;
+} RR_log_v2_header;
+
+typedef struct {
+    uint64_t first_instr_count;
+    uint64_t file_offset;
+    uint64_t stream_offset;
+} RR_block_index_entry;
+
+typedef struct {
+    FILE *fp;
+    uint8_t *buf;
+    size_t len;
+    size_t buf_cap;
+    uint8_t *zbuf;
+    size_t zbuf_len;
+    RR_block_index_entry *index;
+    uint64_t num_blocks;
+    uint64_t index_cap;
+    uint64_t stream_offset;
+    uint64_t first_instr_count;
+} RR_block_writer;
+
+typedef struct {
+    FILE *fp;
+    RR_log_v2_header header;
+    RR_block_index_entry *index;
+    uint8_t *buf;      // current decompressed block
+    size_t len;        // valid bytes in buf
+    size_t pos;        // read position in buf
+    uint64_t block;    // index of the block after the one in buf
+    uint8_t *zbuf;
+    size_t zbuf_len;
+    bool recovered;    // index rebuilt from the blocks of an unfinished log
+} RR_block_reader;
+
+// Writer. fp must be positioned at the start of an empty file. The
+// functions that write to fp return false if compressing or writing fails.
+bool rr_block_writer_init(RR_block_writer *w, FILE *fp);
+// Bracket every entry so that blocks only ever end on entry boundaries.
+void rr_block_writer_begin_entry(RR_block_writer *w, uint64_t instr_count);
+void rr_block_writer_write(RR_block_writer *w, const void *ptr, size_t len);
+bool rr_block_writer_end_entry(RR_block_writer *w);
+// Flush the last block, append the index and fill in the header. Frees the
+// writer's buffers even if it fails.
+bool rr_block_writer_finish(RR_block_writer *w, uint64_t last_instr_count);
+
+// Returns true if fp holds a v2 log. Leaves fp rewound if it does not.
+bool rr_log_is_v2(FILE *fp);
+// Reader. Returns false if fp is not a valid v2 log. The index of a log
+// without one (the recording did not finish) is rebuilt from its blocks.
+bool rr_block_reader_init(RR_block_reader *r, FILE *fp);
+size_t rr_block_reader_read(RR_block_reader *r, void *ptr, size_t len);
+void rr_block_reader_skip(RR_block_reader *r, uint64_t len);
+void rr_block_reader_seek(RR_block_reader *r, uint64_t stream_offset);
+uint64_t rr_block_reader_tell(RR_block_reader *r);
+// Stream offset of the block from which every entry at or after
+// instr_count can be read. O(log n) in the number of blocks.
+uint64_t rr_block_reader_find_instr(RR_block_reader *r, uint64_t instr_count);
+void rr_block_reader_destroy(RR_block_reader *r);
+
+#endif
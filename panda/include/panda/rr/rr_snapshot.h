@@ -0,0 +1,54 @@
+#ifndef __RR_SNAPSHOT_H_
+#define __RR_SNAPSHOT_H_
+
+/* Record/replay start snapshot ("<name>-rr-snp").
+
+   Guest RAM is stored raw, each block at an RR_SNAPSHOT_ALIGN-aligned file
+   offset, so that replay can map it straight into the guest with
+   MAP_PRIVATE: pages are then read from the file on first touch, and
+   replay start time no longer depends on the size of guest memory. All-zero
+   chunks are not written, so they take no space on disk. The rest of the
+   machine state follows as an ordinary savevm stream without its "ram"
+   section:
+
+     RR_snapshot_header
+     RR_snapshot_block[num_blocks]
+     RAM of each block, at RR_snapshot_block.file_offset
+     savevm stream, at RR_snapshot_header.state_offset
+
+   Snapshots written before this format (a bare savevm stream, starting with
+   "QEVM") can still be loaded.
+*/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// "PDRRSNP1" read as a little-endian uint64.
+#define RR_SNAPSHOT_MAGIC 0x31504e5352524450ULL
+#define RR_SNAPSHOT_VERSION 1
+// Large enough for any host page size we map with.
+#define RR_SNAPSHOT_ALIGN (1 << 16)
+
+typedef struct {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t num_blocks;
+    uint64_t state_offset;
+} RR_snapshot_header;
+
+typedef struct {
+    char idstr[256];
+    uint64_t used_length;
+    uint64_t file_offset;
+} RR_snapshot_block;
+
+// Both return a negative value on failure.
+// With background set, guest RAM is written by a forked process while the
+// guest runs on; only device state is saved before returning.
+int rr_snapshot_save(const char *file_name, bool background);
+// Wait for a background snapshot to be on disk.
+int rr_snapshot_wait(void);
+// Call after resetting the machine.
+int rr_snapshot_load(const char *file_name);
+
+#endif
@@ -120,6 +120,8 @@ public:
 
     void generateCode(struct TCGContext *s,
                       struct TranslationBlock *tb);
+    // Called when a TB using function is freed.
+    void releaseFunction(llvm::Function *function);
 
     void writeModule(const char *path);
 };
@@ -58,6 +58,7 @@
 #include <iostream>
 #include <sstream>
 #include <map>
+#include <unordered_map>
 
 #include "panda/cheaders.h"
 #include "panda/tcg-llvm.h"
@@ -103,8 +104,36 @@ struct TCGLLVMContextPrivate {
     /* Count of generated translation blocks */
     int m_tbCount;
 
+    /* In-process code cache. Translated, optimized and instrumented
+     * functions are kept after their TBs are freed and reused for any later
+     * TB with the same TCG ops, e.g. after a tb_flush or when a page is
+     * reloaded. Keyed on two independent hashes of the ops.
+     *
+     * It is not saved to disk: the generated code embeds host addresses
+     * (env, helpers, shadow memory, and the llvm::Instruction pointers the
+     * taint pass hands to its helpers), and this JIT has no object cache,
+     * so nothing in it would be valid in another process. */
+    typedef std::pair<uint64_t, uint64_t> CodeKey;
+    struct CodeKeyHash {
+        size_t operator()(const CodeKey &key) const { return key.first; }
+    };
+    struct CachedCode {
+        Function *function;
+        uint8_t *tc_ptr;
+        uint8_t *tc_end;
+        unsigned refs; /* TBs using it */
+    };
+    std::unordered_map<CodeKey, CachedCode, CodeKeyHash> m_codeCache;
+    std::map<Function *, CodeKey> m_codeKeys;
+    /* Functions still used by TBs when the cache was dropped */
+    std::map<Function *, unsigned> m_staleCode;
+    size_t m_codeCacheUnused;
+
     /* XXX: The following members are "local" to generateCode method */
 
+    /* Translation block being generated */
+    TranslationBlock *m_tb;
+
     /* TCGContext for current translation block */
     TCGContext* m_tcgContext;
 
@@ -196,6 +225,14 @@ public:
 
     void invalidateCachedMemory();
 
+    /* The TCG code keeps panda_guest_pc and rr_guest_instr_count up to
+       date with plain loads and stores. We skip those and generate our
+       own updates at each insn_start, which the taint pass knows about. */
+    bool isPandaUpdateOffset(int64_t offset) const {
+        return offset == -ENV_OFFSET + (int64_t)offsetof(CPUState, panda_guest_pc)
+            || offset == -ENV_OFFSET + (int64_t)offsetof(CPUState, rr_guest_instr_count);
+    }
+
     uint64_t toInteger(Value *v) const {
         if (ConstantInt *cste = dyn_cast<ConstantInt>(v)) {
             return *cste->getValue().getRawData();
@@ -215,6 +252,12 @@ public:
     void generateTraceCall(uintptr_t pc);
     int generateOperation(int opc, const TCGOp *op, const TCGArg *args);
     void generateCode(TCGContext *s, TranslationBlock *tb);
+
+    /* In-process code cache */
+    CodeKey hashOps(TCGContext *s, TranslationBlock *tb);
+    void useCachedCode(TranslationBlock *tb, CachedCode &code);
+    void releaseCode(Function *function);
+    void flushCodeCache(bool all);
 };
 
 /* Custom JITMemoryManager in order to capture the size of
@@ -300,7 +343,7 @@ public:
 
 TCGLLVMContextPrivate::TCGLLVMContextPrivate()
     : m_context(getGlobalContext()), m_builder(m_context), m_tbCount(0),
-      m_tcgContext(NULL), m_tbFunction(NULL)
+      m_codeCacheUnused(0), m_tb(NULL), m_tcgContext(NULL), m_tbFunction(NULL)
 {
     std::memset(m_values, 0, sizeof(m_values));
     std::memset(m_memValuesPtr, 0, sizeof(m_memValuesPtr));
@@ -1002,6 +1045,10 @@ int TCGLLVMContextPrivate::generateOperation(int opc, const TCGOp *op,
         TCGTemp &temp = m_tcgContext->temps[args[0]];               \
         assert(!m_tcgContext->temps[args[1]].name                   \
                 || !strcmp(m_tcgContext->temps[args[1]].name, "env"));\
+        if (isPandaUpdateOffset(args[2])) {                         \
+            setValue(args[0], ConstantInt::get(intType(regBits), 0)); \
+            break;                                                  \
+        }                                                           \
         v = getEnvOffsetPtr(args[2], temp);                         \
         v = m_builder.CreatePointerCast(v, intPtrType(memBits)); \
         v = m_builder.CreateLoad(v);                                \
@@ -1015,6 +1062,9 @@ int TCGLLVMContextPrivate::generateOperation(int opc, const TCGOp *op,
         assert(getValue(args[0])->getType() == intType(regBits));   \
         assert(!m_tcgContext->temps[args[1]].name                   \
                 || !strcmp(m_tcgContext->temps[args[1]].name, "env"));\
+        if (isPandaUpdateOffset(args[2])) {                         \
+            break;                                                  \
+        }                                                           \
         Value* valueToStore = getValue(args[0]);                    \
         Value* storePtr = getEnvOffsetPtr(args[2], temp);           \
         storePtr = m_builder.CreatePointerCast(storePtr, intPtrType(memBits)); \
@@ -1314,7 +1364,27 @@ int TCGLLVMContextPrivate::generateOperation(int opc, const TCGOp *op,
 #undef __OP_QEMU_ST
 
     case INDEX_op_exit_tb:
-        m_builder.CreateRet(ConstantInt::get(wordType(), args[0]));
+        if ((args[0] & ~TB_EXIT_MASK) == (uintptr_t)m_tb) {
+            /* Return the TB that is running rather than the one this code
+             * was generated for, so the code cache can share it with
+             * identical TBs. tcg_llvm_qemu_tb_exec sets last_tb. */
+            MDNode *RuntimeMD = MDNode::get(m_context,
+                    MDString::get(m_context, "runtime"));
+            Value *LastTBPtr = m_builder.CreateIntToPtr(
+                    constInt(sizeof(uintptr_t) * 8,
+                        (uintptr_t)&tcg_llvm_runtime.last_tb),
+                    wordPtrType(), "lasttbp");
+            Instruction *LastTB = m_builder.CreateLoad(LastTBPtr, "lasttb");
+            LastTB->setMetadata("host", RuntimeMD);
+            Value *Ret = m_builder.CreateAdd(LastTB,
+                    ConstantInt::get(wordType(), args[0] & TB_EXIT_MASK));
+            if (Instruction *RetI = dyn_cast<Instruction>(Ret)) {
+                RetI->setMetadata("host", RuntimeMD);
+            }
+            m_builder.CreateRet(Ret);
+        } else {
+            m_builder.CreateRet(ConstantInt::get(wordType(), args[0]));
+        }
         break;
 
     case INDEX_op_goto_tb:
@@ -1435,10 +1505,131 @@ int TCGLLVMContextPrivate::generateOperation(int opc, const TCGOp *op,
     return nb_args;
 }
 
+/* In-process code cache (see m_codeCache) */
+
+#define TCG_LLVM_CODE_CACHE_MAX 65536
+
+TCGLLVMContextPrivate::CodeKey TCGLLVMContextPrivate::hashOps(TCGContext *s,
+        TranslationBlock *tb)
+{
+    uint64_t h1 = 0xcbf29ce484222325ULL, h2 = 0x9e3779b97f4a7c15ULL;
+    auto mix = [&](uint64_t v) {
+        h1 = (h1 ^ v) * 0x100000001b3ULL;
+        h2 = (h2 + v) * 0xff51afd7ed558ccdULL;
+        h2 ^= h2 >> 32;
+    };
+
+    /* Globals are the same for every TB; temps are not. */
+    for (int i = s->nb_globals; i < s->nb_temps; i++) {
+        mix(s->temps[i].type | (s->temps[i].temp_local << 8));
+    }
+
+    const TCGOp *op;
+    for (int opc_index = s->gen_op_buf[0].next; opc_index != 0;
+            opc_index = op->next) {
+        op = &s->gen_op_buf[opc_index];
+        const TCGArg *args = &s->gen_opparam_buf[op->args];
+        const TCGOpDef &def = tcg_op_defs[op->opc];
+        int nb_args = op->opc == INDEX_op_call
+            ? op->callo + op->calli + def.nb_cargs : def.nb_args;
+
+        mix(op->opc | (op->callo << 8) | (op->calli << 16));
+        for (int i = 0; i < nb_args; i++) {
+            if (op->opc == INDEX_op_exit_tb
+                    && (args[i] & ~TB_EXIT_MASK) == (uintptr_t)tb) {
+                /* See INDEX_op_exit_tb in generateOperation */
+                mix(~0ULL);
+                mix(args[i] & TB_EXIT_MASK);
+            } else {
+                mix(args[i]);
+            }
+        }
+    }
+    return CodeKey(h1, h2);
+}
+
+void TCGLLVMContextPrivate::useCachedCode(TranslationBlock *tb,
+        CachedCode &code)
+{
+    if (code.refs++ == 0) m_codeCacheUnused--;
+
+    if(execute_llvm || qemu_loglevel_mask(CPU_LOG_LLVM_ASM)) {
+        if (!code.tc_ptr) {
+            code.tc_ptr = (uint8_t*)
+                    m_executionEngine->getPointerToFunction(code.function);
+            code.tc_end = code.tc_ptr +
+                    m_jitMemoryManager->getFunctionSize(code.function);
+
+            assert(code.tc_ptr);
+            assert(code.tc_end > code.tc_ptr);
+        }
+        tb->llvm_tc_ptr = code.tc_ptr;
+        tb->llvm_tc_end = code.tc_end;
+    } else {
+        tb->llvm_tc_ptr = 0;
+        tb->llvm_tc_end = 0;
+    }
+    tb->llvm_function = code.function;
+
+    if(qemu_loglevel_mask(CPU_LOG_LLVM_IR)) {
+        std::string fcnString;
+        llvm::raw_string_ostream s(fcnString);
+        s << *code.function;
+        qemu_log("OUT (LLVM IR):\n");
+        qemu_log("%s", s.str().c_str());
+        qemu_log("\n");
+        qemu_log_flush();
+    }
+}
+
+void TCGLLVMContextPrivate::releaseCode(Function *function)
+{
+    auto stale = m_staleCode.find(function);
+    if (stale != m_staleCode.end()) {
+        if (--stale->second == 0) {
+            m_staleCode.erase(stale);
+            function->eraseFromParent();
+        }
+        return;
+    }
+
+    CachedCode &code = m_codeCache[m_codeKeys.at(function)];
+    assert(code.refs > 0);
+    if (--code.refs == 0 && ++m_codeCacheUnused > TCG_LLVM_CODE_CACHE_MAX) {
+        flushCodeCache(false);
+    }
+}
+
+/* Erase unused functions. If all is set, also forget the ones still in use,
+ * which are then erased once their last TB is freed. */
+void TCGLLVMContextPrivate::flushCodeCache(bool all)
+{
+    for (auto it = m_codeCache.begin(); it != m_codeCache.end();) {
+        Function *function = it->second.function;
+        if (it->second.refs == 0) {
+            function->eraseFromParent();
+        } else if (all) {
+            m_staleCode[function] = it->second.refs;
+        } else {
+            ++it;
+            continue;
+        }
+        m_codeKeys.erase(function);
+        it = m_codeCache.erase(it);
+    }
+    m_codeCacheUnused = 0;
+}
+
 void TCGLLVMContextPrivate::generateCode(TCGContext *s, TranslationBlock *tb)
 {
+    CodeKey key = hashOps(s, tb);
+    auto cached = m_codeCache.find(key);
+    if (cached != m_codeCache.end()) {
+        useCachedCode(tb, cached->second);
+        return;
+    }
+
     /* Create new function for current translation block */
-    /* TODO: compute the checksum of the tb to see if we can reuse some code */
     std::ostringstream fName;
 
     fName << "tcg-llvm-tb-" << (m_tbCount++) << "-" << std::hex << tb->pc;
@@ -1470,6 +1661,7 @@ void TCGLLVMContextPrivate::generateCode(TCGContext *s, TranslationBlock *tb)
     m_builder.SetInsertPoint(basicBlock);
 
     m_tcgContext = s;
+    m_tb = tb;
 
     /* Prepare globals and temps information */
     initGlobalsAndLocalTemps();
@@ -1553,30 +1745,11 @@ void TCGLLVMContextPrivate::generateCode(TCGContext *s, TranslationBlock *tb)
     verifyFunction(*m_tbFunction);
 #endif
 
-    tb->llvm_function = m_tbFunction;
-
-    if(execute_llvm || qemu_loglevel_mask(CPU_LOG_LLVM_ASM)) {
-        tb->llvm_tc_ptr = (uint8_t*)
-                m_executionEngine->getPointerToFunction(m_tbFunction);
-        tb->llvm_tc_end = tb->llvm_tc_ptr +
-                m_jitMemoryManager->getFunctionSize(m_tbFunction);
-
-        assert(tb->llvm_tc_ptr);
-        assert(tb->llvm_tc_end > tb->llvm_tc_ptr);
-    } else {
-        tb->llvm_tc_ptr = 0;
-        tb->llvm_tc_end = 0;
-    }
-
-    if(qemu_loglevel_mask(CPU_LOG_LLVM_IR)) {
-        std::string fcnString;
-        llvm::raw_string_ostream s(fcnString);
-        s << *m_tbFunction;
-        qemu_log("OUT (LLVM IR):\n");
-        qemu_log("%s", s.str().c_str());
-        qemu_log("\n");
-        qemu_log_flush();
-    }
+    CachedCode &code = m_codeCache[key];
+    code = CachedCode { m_tbFunction, NULL, NULL, 0 };
+    m_codeKeys[m_tbFunction] = key;
+    m_codeCacheUnused++;
+    useCachedCode(tb, code);
 }
 
 /***********************************/
@@ -1594,6 +1767,8 @@ TCGLLVMContext::~TCGLLVMContext()
 
 llvm::FunctionPassManager* TCGLLVMContext::getFunctionPassManager() const
 {
+    /* The caller may add passes, after which cached code is out of date. */
+    m_private->flushCodeCache(true);
     return m_private->getFunctionPassManager();
 }
 
@@ -1626,6 +1801,11 @@ void TCGLLVMContext::generateCode(TCGContext *s, TranslationBlock *tb)
     m_private->generateCode(s, tb);
 }
 
+void TCGLLVMContext::releaseFunction(llvm::Function *function)
+{
+    m_private->releaseCode(function);
+}
+
 void TCGLLVMContext::writeModule(const char *path)
 {
     std::string Error;
@@ -1669,7 +1849,7 @@ void tcg_llvm_tb_alloc(TranslationBlock *tb)
 void tcg_llvm_tb_free(TranslationBlock *tb)
 {
     if(tb->llvm_function) {
-        tb->llvm_function->eraseFromParent();
+        tb->tcg_llvm_context->releaseFunction(tb->llvm_function);
         tb->llvm_function = NULL;
         tb->llvm_tc_ptr = NULL;
         tb->llvm_tc_end = NULL;
@@ -23,6 +23,7 @@ PANDAENDCOMMENT */
 
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <vector>
 #include <algorithm>
 
@@ -99,14 +100,43 @@ target_ulong cached_asid = 0;
 typedef target_ulong stackid;
 #endif
 
-// stackid -> shadow stack
-std::map<stackid, std::vector<stack_entry>> callstacks;
-// stackid -> function entry points
-std::map<stackid, std::vector<target_ulong>> function_stacks;
-// EIP -> instr_type
-std::map<target_ulong, instr_type> call_cache;
-// stackid -> address of Stopped block
-std::map<stackid, target_ulong> stoppedInfo;
+// Everything we track for one stack, so a single lookup finds all of it.
+struct callstack {
+    // shadow stack
+    std::vector<stack_entry> calls;
+    // function entry points, parallel to calls
+    std::vector<target_ulong> functions;
+    // address of Stopped block, if stopped is set
+    target_ulong stopped_pc;
+    bool stopped;
+};
+
+struct stackid_hash {
+#ifdef USE_STACK_HEURISTIC
+    size_t operator()(const stackid &id) const {
+        return std::hash<target_ulong>()(id.first) * 31 +
+            std::hash<target_ulong>()(id.second);
+    }
+#else
+    size_t operator()(const stackid &id) const {
+        return std::hash<target_ulong>()(id);
+    }
+#endif
+};
+
+// stackid -> stack state. Elements never move, so last_stack stays valid.
+std::unordered_map<stackid, callstack, stackid_hash> callstacks;
+// one-entry cache in front of callstacks; consecutive blocks almost
+// always run on the same stack
+static stackid last_stackid;
+static callstack *last_stack = NULL;
+// number of stacks with a Stopped block
+static size_t num_stopped = 0;
+
+// TB index -> instr_type of the block's last instruction. TBs are allocated
+// from one array (tcg_ctx.tb_ctx.tbs), and every translation overwrites its
+// slot, so the type of an executing block is a single load.
+static uint8_t *tb_types = NULL;
 
 int last_ret_size = 0;
 
@@ -200,6 +230,25 @@ static stackid get_stackid(CPUArchState* env) {
 #endif
 }
 
+static inline callstack &get_callstack(stackid id) {
+    if (last_stack == NULL || id != last_stackid) {
+        last_stack = &callstacks[id];
+        last_stackid = id;
+    }
+    return *last_stack;
+}
+
+static inline void clear_stopped(callstack &cs) {
+    if (cs.stopped) {
+        cs.stopped = false;
+        num_stopped--;
+    }
+}
+
+static inline size_t tb_index(TranslationBlock *tb) {
+    return tb - tcg_ctx.tb_ctx.tbs;
+}
+
 instr_type disas_block(CPUArchState* env, target_ulong pc, int size) {
     unsigned char *buf = (unsigned char *) malloc(size);
     int err = panda_virtual_memory_rw(ENV_GET_CPU(env), pc, buf, size, 0);
@@ -262,7 +311,12 @@ done2:
 int after_block_translate(CPUState *cpu, TranslationBlock *tb) {
     CPUArchState* env = (CPUArchState*)cpu->env_ptr;
 
-    call_cache[tb->pc] = disas_block(env, tb->pc, tb->size);
+    // tcg is set up after plugins are loaded
+    if (tb_types == NULL) {
+        tb_types = (uint8_t *) calloc(tcg_ctx.code_gen_max_blocks, 1);
+        assert(tb_types);
+    }
+    tb_types[tb_index(tb)] = disas_block(env, tb->pc, tb->size);
 
     return 1;
 }
@@ -278,21 +332,17 @@ int before_block_exec(CPUState *cpu, TranslationBlock *tb) {
     // the retry
     bool needToCheck = true;
     stackid curStackid = get_stackid(env);
-    std::map<stackid, target_ulong>::const_iterator it;
-    it = stoppedInfo.find(curStackid);
-    if (it != stoppedInfo.end()) {
-        target_ulong stoppedPC = stoppedInfo[curStackid];
-        if (stoppedPC == tb->pc) {
-            stoppedInfo.erase(it);
-            needToCheck = false;
-            verbose_log("callstack_instr skipping return check", tb, curStackid,
-                    false);
-        }
+    callstack &cs = get_callstack(curStackid);
+    if (cs.stopped && cs.stopped_pc == tb->pc) {
+        clear_stopped(cs);
+        needToCheck = false;
+        verbose_log("callstack_instr skipping return check", tb, curStackid,
+                false);
     }
 
     if (needToCheck) {
-        std::vector<stack_entry> &v = callstacks[get_stackid(env)];
-        std::vector<target_ulong> &w = function_stacks[get_stackid(env)];
+        std::vector<stack_entry> &v = cs.calls;
+        std::vector<target_ulong> &w = cs.functions;
         if (v.empty()) return 1;
 
         // Search up to 10 down
@@ -320,23 +370,33 @@ int after_block_exec(CPUState* cpu, TranslationBlock *tb, uint8_t exitCode) {
     uint32_t flags;
 
     CPUArchState* env = (CPUArchState*)cpu->env_ptr;
-    instr_type tb_type = call_cache[tb->pc];
+    instr_type tb_type = tb_types ? (instr_type) tb_types[tb_index(tb)]
+                                  : INSTR_UNKNOWN;
+
+    // common case: a completed block that neither calls nor returns, with
+    // no Stopped block anywhere to clear
+    if (exitCode <= TB_EXIT_IDX1 && tb_type == INSTR_UNKNOWN &&
+            num_stopped == 0) {
+        return 1;
+    }
+
     stackid curStackid = get_stackid(env);
+    callstack &cs = get_callstack(curStackid);
 
     // sometimes an attempt to run a block is interrupted, but this callback is
     // still made - only update the callstack if the block ran to completion
     if (exitCode <= TB_EXIT_IDX1) {
         // this attempt is OK, so remove it from the Stopped list, if there
-        stoppedInfo.erase(curStackid);
+        clear_stopped(cs);
 
         if (tb_type == INSTR_CALL) {
             stack_entry se = {tb->pc+tb->size,tb_type};
-            callstacks[curStackid].push_back(se);
+            cs.calls.push_back(se);
 
             // Also track the function that gets called
             // This retrieves the pc in an architecture-neutral way
             cpu_get_tb_cpu_state(env, &pc, &cs_base, &flags);
-            function_stacks[curStackid].push_back(pc);
+            cs.functions.push_back(pc);
 
             PPP_RUN_CB(on_call, cpu, pc);
         }
@@ -356,10 +416,11 @@ int after_block_exec(CPUState* cpu, TranslationBlock *tb, uint8_t exitCode) {
         }
 
         cpu_get_tb_cpu_state(env, &pc, &cs_base, &flags);
-        // C++ maps don't let you replace value of an existing key (grr)
-        // erase nicely does nothing if key DNE
-        stoppedInfo.erase(curStackid);
-        stoppedInfo[curStackid] = pc;
+        if (!cs.stopped) {
+            cs.stopped = true;
+            num_stopped++;
+        }
+        cs.stopped_pc = pc;
     }
 
     return 1;
@@ -371,7 +432,7 @@ int after_block_exec(CPUState* cpu, TranslationBlock *tb, uint8_t exitCode) {
  */
 uint32_t get_callers(target_ulong callers[], uint32_t n, CPUState* cpu) {
     CPUArchState* env = (CPUArchState*)cpu->env_ptr;
-    std::vector<stack_entry> &v = callstacks[get_stackid(env)];
+    std::vector<stack_entry> &v = get_callstack(get_stackid(env)).calls;
 
     n = std::min((uint32_t)v.size(), n);
     for (uint32_t i=0; i<n; i++) { callers[i] = v[v.size()-1-i].pc; }
@@ -386,7 +447,7 @@ uint32_t get_callers(target_ulong callers[], uint32_t n, CPUState* cpu) {
 Panda__CallStack *pandalog_callstack_create() {
     assert(pandalog);
     CPUArchState* env = (CPUArchState*)first_cpu->env_ptr;
-    std::vector<stack_entry> &v = callstacks[get_stackid(env)];
+    std::vector<stack_entry> &v = get_callstack(get_stackid(env)).calls;
 
     Panda__CallStack *cs = (Panda__CallStack *)malloc(sizeof(Panda__CallStack));
     *cs = PANDA__CALL_STACK__INIT;
@@ -413,7 +474,7 @@ void pandalog_callstack_free(Panda__CallStack *cs) {
  */
 uint32_t get_functions(target_ulong functions[], uint32_t n, CPUState* cpu) {
     CPUArchState* env = (CPUArchState*)cpu->env_ptr;
-    std::vector<target_ulong> &v = function_stacks[get_stackid(env)];
+    std::vector<target_ulong> &v = get_callstack(get_stackid(env)).functions;
 
     n = std::min((uint32_t)v.size(), n);
     for (uint32_t i=0; i<n; i++) { functions[i] = v[v.size()-1-i]; }
@@ -502,6 +563,7 @@ bool init_plugin(void *self) {
 }
 
 void uninit_plugin(void *self) {
+    free(tb_types);
 }
 
 /* vim: set tabstop=4 softtabstop=4 expandtab ft=cpp: */
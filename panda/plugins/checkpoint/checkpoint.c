@@ -17,6 +17,7 @@
 #include "panda/checkpoint.h"
 
 uint64_t checkpoint_instr_size;
+uint64_t checkpoint_space;
 
 bool init_plugin(void *);
 void uninit_plugin(void *);
@@ -29,6 +30,10 @@ bool before_block_exec(CPUState *env, TranslationBlock *tb) {
 
     if (progress == 0 || rr_get_guest_instr_count()/checkpoint_instr_size > progress) {
         progress++;
+        if (get_checkpoint_usage() >= checkpoint_space) {
+            // out of space; keep what we have.
+            return false;
+        }
         printf("Taking panda checkpoint %u... at %lu\n", progress, rr_get_guest_instr_count());
         panda_checkpoint();
         printf("Done.\n");
@@ -53,16 +58,26 @@ void after_init(CPUState* env) {
     panda_arg_list *args = panda_get_args("checkpoint");
 
     const char* avail_space = panda_parse_string_opt(args, "space", "6G", "Available disk/RAM space for storing checkpoints");
+    checkpoint_incremental = panda_parse_bool_opt(args, "incremental", "Store only the pages dirtied since the previous checkpoint instead of full savevm checkpoints");
+    checkpoint_fork = panda_parse_bool_opt(args, "fork", "Take checkpoints by forking the replay and parking the child");
+    uint32_t max_checkpoints = panda_parse_uint32_opt(args, "max", MAX_CHECKPOINTS, "Maximum number of incremental or fork checkpoints");
     uint64_t space_bytes;
     parse_option_size("space", avail_space, &space_bytes, NULL );
+    checkpoint_space = space_bytes;
 
     // Get approx size of each checkpoint
     printf("Avail space %lx, ram_size %lx\n", space_bytes, ram_size);
-    if (space_bytes < ram_size){
+    if (!checkpoint_fork && space_bytes < ram_size){
         fprintf(stderr, "Not enough RAM for a checkpoint!\n");
         abort();
     }
-    uint64_t num_checkpoints = space_bytes/ram_size;
+    // Full checkpoints each cost about ram_size. Incremental ones only cost
+    // the pages dirtied in between, so spread as many as allowed over the
+    // replay and stop early if the space runs out. Fork checkpoints share
+    // unmodified pages with the replay, which the kernel accounts for.
+    uint64_t num_checkpoints = (checkpoint_incremental || checkpoint_fork)
+        ? MIN(max_checkpoints, MAX_CHECKPOINTS)
+        : space_bytes/ram_size;
     printf("Number of checkpoints allowed:  %lu\n", num_checkpoints);
     checkpoint_instr_size = rr_nondet_log->last_prog_point.guest_instr_count/num_checkpoints;
     if (checkpoint_instr_size < 500000)
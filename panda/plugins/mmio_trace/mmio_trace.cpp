@@ -12,15 +12,33 @@ PANDAENDCOMMENT */
 #define __STDC_FORMAT_MACROS
 
 #include "mmio_trace.h" // mmio_event_t, panda imports
-#include <tuple>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <thread>
 #include <vector>
 #include <iostream>
-#include <iomanip>
-#include <fstream>
+#include <signal.h>
 
 const char* fn_str;
 std::vector<mmio_event_t> mmio_events;
 
+// Events are handed from the vCPU thread to a writer thread through a
+// single-producer, single-consumer ring, so memory use stays fixed no matter
+// how long the replay is, and the vCPU thread never does file I/O.
+static mmio_trace_record_t *ring;
+static uint64_t ring_mask;
+static std::atomic<uint64_t> ring_head(0);  // next slot the vCPU fills
+static std::atomic<uint64_t> ring_tail(0);  // next slot the writer drains
+static std::atomic<bool> writer_stop(false);
+static std::thread writer;
+
+static FILE *out_log_file;
+static bool out_text;
+static bool write_failed;
+
 // These need to be extern "C" so that the ABI is compatible with
 // QEMU/PANDA, which is written in C
 extern "C" {
@@ -30,42 +48,80 @@ void uninit_plugin(void *);
 
 }
 
+static void record_mmio(CPUState *env, char access_type, target_ulong addr, int size, uint64_t val) {
+    if (!out_log_file) {
+        // Without a log, events are kept for get_mmio_events()
+        mmio_event_t new_event{access_type, env->panda_guest_pc, addr, size, val};
+        mmio_events.push_back(new_event);
+        return;
+    }
+
+    uint64_t head = ring_head.load(std::memory_order_relaxed);
+    // Ring full: wait for the writer rather than drop events
+    while (head - ring_tail.load(std::memory_order_acquire) > ring_mask) {
+        std::this_thread::yield();
+    }
+    mmio_trace_record_t *r = &ring[head & ring_mask];
+    r->prog_counter = env->panda_guest_pc;
+    r->phys_addr = addr;
+    r->value = val;
+    r->size = size;
+    r->access_type = access_type;
+    ring_head.store(head + 1, std::memory_order_release);
+}
+
 int buffer_mmio_read(CPUState *env, target_ulong addr, int size, uint64_t val) {
-    mmio_event_t new_event{'W', env->panda_guest_pc, addr, size, val};
-    mmio_events.push_back(new_event);
+    record_mmio(env, 'R', addr, size, val);
     return 0;
 }
 
 int buffer_mmio_write(CPUState *env, target_ulong addr, int size, uint64_t val) {
-    mmio_event_t new_event{'R', env->panda_guest_pc, addr, size, val};
-    mmio_events.push_back(new_event);
+    record_mmio(env, 'W', addr, size, val);
     return 0;
 }
 
-// File I/O inside of a callback would be horridly slow, so we delay log flush until uninit_plugin()
-void flush_to_mmio_log_file() {
-
-    if (!fn_str) { return; }    // Pre-condition
-
-    std::ofstream out_log_file(fn_str);
-    int hex_width = (sizeof(target_ulong) << 1);
-
-    for (auto const& event : mmio_events) {
-
-        // Write log line
-        out_log_file
-            << std::hex << std::setfill('0')
-            << event.access_type << ":"                                     // R or W
-            << "0x" << std::setw(hex_width) << event.prog_counter << ":"    // Guest PC
-            << "0x" << std::setw(hex_width) << event.phys_addr << ":"       // Physical Address
-            << "0x" << std::setw(hex_width) << event.size << ":"            // Size
-            << "0x" << std::setw(hex_width) << event.value                  // Value
-            << std::endl;
+static void write_records(const mmio_trace_record_t *recs, uint64_t n) {
+    if (write_failed) return;
+
+    if (!out_text) {
+        write_failed = fwrite(recs, sizeof(*recs), n, out_log_file) != n;
+    } else {
+        int hex_width = (sizeof(target_ulong) << 1);
+        for (uint64_t i = 0; i < n && !write_failed; i++) {
+            const mmio_trace_record_t *r = &recs[i];
+            write_failed = fprintf(out_log_file,
+                    "%c:0x%0*" PRIx64 ":0x%0*" PRIx64 ":0x%0*x:0x%0*" PRIx64 "\n",
+                    r->access_type,                       // R or W
+                    hex_width, r->prog_counter,           // Guest PC
+                    hex_width, r->phys_addr,              // Physical Address
+                    hex_width, r->size,                   // Size
+                    hex_width, r->value) < 0;             // Value
+        }
+    }
+    if (write_failed) {
+        std::cerr << "Error writing to " << fn_str << std::endl;
+    }
+}
 
-        // Validate write
-        if (!out_log_file.good()) {
-            std::cerr << "Error writing to " << fn_str << std::endl;
-            return;
+// writer thread: drain the ring into the log until told to stop
+static void write_mmio_log() {
+    uint64_t tail = ring_tail.load(std::memory_order_relaxed);
+    while (true) {
+        // Read the stop flag first: once it is set, head is final.
+        bool stop = writer_stop.load(std::memory_order_acquire);
+        uint64_t head = ring_head.load(std::memory_order_acquire);
+        if (head == tail) {
+            if (stop) break;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+        // [tail, head) is at most two contiguous pieces of the ring
+        while (tail != head) {
+            uint64_t start = tail & ring_mask;
+            uint64_t n = std::min(head - tail, ring_mask + 1 - start);
+            write_records(&ring[start], n);
+            tail += n;
+            ring_tail.store(tail, std::memory_order_release);
         }
     }
 }
@@ -93,8 +149,36 @@ bool init_plugin(void* self) {
     panda_arg_list* panda_args = panda_get_args("mmio_trace");
 
     fn_str = panda_parse_string_opt(panda_args, "out_log", nullptr, "File to write MMIO trace log to.");
+    out_text = panda_parse_bool_opt(panda_args, "text", "Write the log as text rather than binary.");
+    uint64_t buf_events = panda_parse_uint64_opt(panda_args, "buf_events", 1 << 16,
+            "Number of events buffered between the guest and the log writer.");
     if (!fn_str) {
-        std::cerr << "No \'out_log\' specified, MMIO R/W will not be logged!" << std::endl;
+        std::cerr << "No \'out_log\' specified, MMIO R/W will only be available through get_mmio_events()" << std::endl;
+    } else {
+        out_log_file = fopen(fn_str, out_text ? "w" : "wb");
+        if (!out_log_file) {
+            std::cerr << "Could not open " << fn_str << std::endl;
+            return false;
+        }
+        if (!out_text) {
+            mmio_trace_header_t header = {};
+            memcpy(header.magic, MMIO_TRACE_MAGIC, sizeof(header.magic));
+            header.version = MMIO_TRACE_VERSION;
+            header.addr_bytes = sizeof(target_ulong);
+            fwrite(&header, sizeof(header), 1, out_log_file);
+        }
+
+        uint64_t ring_size = 1;
+        while (ring_size < buf_events) ring_size <<= 1;
+        ring = new mmio_trace_record_t[ring_size]();
+        ring_mask = ring_size - 1;
+
+        // Like qemu_thread_create(), keep signals on the vCPU thread.
+        sigset_t all, old;
+        sigfillset(&all);
+        pthread_sigmask(SIG_SETMASK, &all, &old);
+        writer = std::thread(write_mmio_log);
+        pthread_sigmask(SIG_SETMASK, &old, NULL);
     }
 
     panda_enable_precise_pc();
@@ -109,5 +193,12 @@ bool init_plugin(void* self) {
 }
 
 void uninit_plugin(void *self) {
-    flush_to_mmio_log_file();
-}
\ No newline at end of file
+    if (!out_log_file) return;
+
+    writer_stop.store(true, std::memory_order_release);
+    writer.join();
+    fclose(out_log_file);
+    out_log_file = NULL;
+    delete[] ring;
+    ring = NULL;
+}
@@ -8,4 +8,25 @@ typedef struct mmio_event_t {
     target_ulong phys_addr;
     int size;
     uint64_t value;
-} mmio_event_t;
\ No newline at end of file
+} mmio_event_t;
+
+// Binary trace file (the default out_log format): a header followed by
+// fixed-size records in host byte order. panda/scripts/mmio_trace_to_text.py
+// turns it into the text format.
+#define MMIO_TRACE_MAGIC "PMIOTRC1"
+#define MMIO_TRACE_VERSION 1
+
+typedef struct mmio_trace_header_t {
+    char magic[8];
+    uint32_t version;
+    uint32_t addr_bytes;    // sizeof(target_ulong), sets the text field width
+} mmio_trace_header_t;
+
+typedef struct mmio_trace_record_t {
+    uint64_t prog_counter;
+    uint64_t phys_addr;
+    uint64_t value;
+    uint32_t size;
+    char access_type;
+    uint8_t pad[3];
+} mmio_trace_record_t;
@@ -200,4 +200,34 @@ static inline OsiModule *copy_osimod(OsiModule *from, OsiModule *to) {
     return to;
 }
 
+/**
+ * @brief Copies a GArray of OsiProc structs, including their contents.
+ * Returns a new array that is freed with g_array_free(a, true).
+ */
+static inline GArray *copy_osiprocs_g(GArray *from) {
+    if (from == NULL) return NULL;
+    GArray *to = g_array_sized_new(false, true, sizeof(OsiProc), from->len);
+    g_array_set_clear_func(to, (GDestroyNotify)free_osiproc_contents);
+    g_array_set_size(to, from->len);
+    for (guint i = 0; i < from->len; i++) {
+        copy_osiproc(&g_array_index(from, OsiProc, i), &g_array_index(to, OsiProc, i));
+    }
+    return to;
+}
+
+/**
+ * @brief Copies a GArray of OsiModule structs, including their contents.
+ * Returns a new array that is freed with g_array_free(a, true).
+ */
+static inline GArray *copy_osimods_g(GArray *from) {
+    if (from == NULL) return NULL;
+    GArray *to = g_array_sized_new(false, true, sizeof(OsiModule), from->len);
+    g_array_set_clear_func(to, (GDestroyNotify)free_osimodule_contents);
+    g_array_set_size(to, from->len);
+    for (guint i = 0; i < from->len; i++) {
+        copy_osimod(&g_array_index(from, OsiModule, i), &g_array_index(to, OsiModule, i));
+    }
+    return to;
+}
+
 /* vim:set tabstop=4 softtabstop=4 expandtab: */
@@ -10,6 +10,7 @@
 #include <cstdlib>
 #include <cerrno>
 #include <map>
+#include <unordered_set>
 #include <glib.h>
 
 #include "panda/plugin.h"
@@ -39,6 +40,8 @@ void on_get_current_process_handle(CPUState *env, OsiProcHandle **out_p);
 void on_get_process(CPUState *, const OsiProcHandle *, OsiProc **);
 void on_get_libraries(CPUState *env, OsiProc *p, GArray **out);
 void on_get_current_thread(CPUState *env, OsiThread *t);
+int osi_cache_asid_changed(CPUState *env, target_ulong oldval, target_ulong newval);
+int osi_cache_mem_write(CPUState *env, target_ulong pc, target_ulong addr, target_ulong size, void *buf);
 
 struct kernelinfo ki;
 struct KernelProfile const *kernel_profile = &DEFAULT_PROFILE;
@@ -273,6 +276,195 @@ void fill_osithread(CPUState *env, OsiThread *t,
 	t->pid = get_tgid(env, task_addr);
 }
 
+/* ******************************************************************
+ Introspection cache
+****************************************************************** */
+
+/*
+ * Consumers may ask for the same information many times between two
+ * context switches, e.g. get_current_process() in every before_block_exec.
+ * Results are kept here, tagged with the cache_version that was current
+ * when they were read. The version is bumped on every asid change and,
+ * with cache_watch, on every kernel write to a field the cached results
+ * were read from.
+ *
+ * The current process is keyed on (asid, task_struct). Its name and
+ * parent can still change under the same key: execve switches mm before it
+ * sets comm, prctl(PR_SET_NAME) renames a task, and orphans are reparented.
+ * Only cache_watch notices those (comm and real_parent are watched), so
+ * with plain `cache` a stale name or ppid may be returned. Process and
+ * module lists can change without an asid change (fork, mmap), so they are
+ * only cached when kernel writes are watched.
+ */
+static bool cache_enabled;
+static bool cache_watch;
+static uint64_t cache_version = 1;
+
+static struct {
+	uint64_t version;
+	target_ulong asid;
+	target_ptr_t ts;
+	OsiProc *proc;
+} current_proc_cache;
+
+static GArray *procs_cache;
+static uint64_t procs_cache_version;
+static std::map<target_ptr_t, GArray *> libs_cache;
+static uint64_t libs_cache_version;
+
+// Pointer-aligned addresses of the kernel fields the cache was filled from.
+static std::unordered_set<target_ptr_t> watched;
+
+#define WATCH_ALIGN(addr) ((addr) & ~(target_ptr_t)(sizeof(target_ptr_t) - 1))
+
+static void watch_range(target_ptr_t addr, size_t size) {
+	for (target_ptr_t a = WATCH_ALIGN(addr); a < addr + size; a += sizeof(target_ptr_t)) {
+		watched.insert(a);
+	}
+}
+
+/**
+ * @brief Watches the task_struct fields read by fill_osiproc() and the
+ * process list traversal.
+ */
+static void watch_task(target_ptr_t ts) {
+	watch_range(ts + ki.task.tasks_offset, 2 * sizeof(target_ptr_t));
+	watch_range(ts + ki.task.comm_offset, ki.task.comm_size);
+	watch_range(ts + ki.task.tgid_offset, sizeof(target_pid_t));
+	watch_range(ts + ki.task.group_leader_offset, sizeof(target_ptr_t));
+	watch_range(ts + ki.task.real_parent_offset, sizeof(target_ptr_t));
+	watch_range(ts + ki.task.mm_offset, sizeof(target_ptr_t));
+}
+
+/**
+ * @brief Watches the mm_struct and vm_area_struct fields read by
+ * on_get_libraries() and fill_osimodule().
+ */
+static void watch_vmas(CPUState *env, target_ptr_t ts) {
+	target_ptr_t mm = get_mm(env, ts);
+	if (mm == (target_ptr_t)NULL) return;
+	watch_range(ts + ki.task.mm_offset, sizeof(target_ptr_t));
+	watch_range(mm + ki.mm.mmap_offset, sizeof(target_ptr_t));
+	watch_range(mm + ki.mm.start_brk_offset, sizeof(target_ptr_t));
+	watch_range(mm + ki.mm.brk_offset, sizeof(target_ptr_t));
+	watch_range(mm + ki.mm.start_stack_offset, sizeof(target_ptr_t));
+
+	target_ptr_t vma_first, vma_current;
+	vma_first = vma_current = get_vma_first(env, ts);
+	while (vma_current != (target_ptr_t)NULL) {
+		watch_range(vma_current + ki.vma.vm_start_offset, sizeof(target_ulong));
+		watch_range(vma_current + ki.vma.vm_end_offset, sizeof(target_ulong));
+		watch_range(vma_current + ki.vma.vm_next_offset, sizeof(target_ptr_t));
+		watch_range(vma_current + ki.vma.vm_file_offset, sizeof(target_ptr_t));
+		vma_current = get_vma_next(env, vma_current);
+		if (vma_current == vma_first) break;
+	}
+}
+
+static void fill_osiproc_watched(CPUState *env, OsiProc *p, target_ptr_t task_addr) {
+	fill_osiproc(env, p, task_addr);
+	watch_task(task_addr);
+}
+
+static void cache_invalidate(void) {
+	cache_version++;
+	watched.clear();
+}
+
+int osi_cache_asid_changed(CPUState *env, target_ulong oldval, target_ulong newval) {
+	cache_invalidate();
+	return 0;
+}
+
+int osi_cache_mem_write(CPUState *env, target_ulong pc, target_ulong addr,
+						target_ulong size, void *buf) {
+	if (watched.empty() || !panda_in_kernel(env)) return 0;
+	for (target_ptr_t a = WATCH_ALIGN(addr); a < addr + size; a += sizeof(target_ptr_t)) {
+		if (watched.count(a)) {
+			cache_invalidate();
+			break;
+		}
+	}
+	return 0;
+}
+
+/**
+ * @brief Returns the cached process for task_struct \p ts, reading it
+ * from the guest if the cache is stale. The result is owned by the cache.
+ */
+static OsiProc *cached_current_process(CPUState *env, target_ptr_t ts) {
+	target_ulong asid = panda_current_asid(env);
+	if (current_proc_cache.version != cache_version ||
+		current_proc_cache.asid != asid || current_proc_cache.ts != ts) {
+		if (current_proc_cache.proc == NULL) {
+			current_proc_cache.proc = (OsiProc *)g_malloc0(sizeof(OsiProc));
+		}
+		free_osiproc_contents(current_proc_cache.proc);
+		if (cache_watch) {
+			fill_osiproc_watched(env, current_proc_cache.proc, ts);
+		} else {
+			fill_osiproc(env, current_proc_cache.proc, ts);
+		}
+		current_proc_cache.version = cache_version;
+		current_proc_cache.asid = asid;
+		current_proc_cache.ts = ts;
+	}
+	return current_proc_cache.proc;
+}
+
+/**
+ * @brief Returns the cached process list, reading it from the guest if the
+ * cache is stale. The result is owned by the cache and may be NULL.
+ */
+static GArray *cached_processes(CPUState *env) {
+	if (procs_cache_version != cache_version) {
+		if (procs_cache != NULL) {
+			g_array_free(procs_cache, true);
+			procs_cache = NULL;
+		}
+		get_process_info<>(env, &procs_cache, fill_osiproc_watched, free_osiproc_contents);
+		procs_cache_version = cache_version;
+	}
+	return procs_cache;
+}
+
+static void get_libraries(CPUState *env, OsiProc *p, GArray **out);
+
+/**
+ * @brief Returns the cached module list of \p p, reading it from the
+ * guest if the cache is stale. The result is owned by the cache and may
+ * be NULL.
+ */
+static GArray *cached_libraries(CPUState *env, OsiProc *p) {
+	if (libs_cache_version != cache_version) {
+		for (auto &kv : libs_cache) {
+			if (kv.second != NULL) g_array_free(kv.second, true);
+		}
+		libs_cache.clear();
+		libs_cache_version = cache_version;
+	}
+	auto it = libs_cache.find(p->taskd);
+	if (it != libs_cache.end()) return it->second;
+
+	GArray *ms = NULL;
+	get_libraries(env, p, &ms);
+	watch_vmas(env, p->taskd);
+	libs_cache[p->taskd] = ms;
+	return ms;
+}
+
+static void cache_free(void) {
+	free_osiproc(current_proc_cache.proc);
+	current_proc_cache.proc = NULL;
+	if (procs_cache != NULL) g_array_free(procs_cache, true);
+	procs_cache = NULL;
+	for (auto &kv : libs_cache) {
+		if (kv.second != NULL) g_array_free(kv.second, true);
+	}
+	libs_cache.clear();
+	watched.clear();
+}
+
 /* ******************************************************************
  PPP Callbacks
 ****************************************************************** */
@@ -282,6 +474,11 @@ void fill_osithread(CPUState *env, OsiThread *t,
  *
  */
 void on_get_processes(CPUState *env, GArray **out) {
+	if (cache_watch) {
+		g_array_free(*out, true);  // safe even when *out == NULL
+		*out = copy_osiprocs_g(cached_processes(env));
+		return;
+	}
 	// instantiate and call function from get_process_info template
 	get_process_info<>(env, out, fill_osiproc, free_osiproc_contents);
 }
@@ -290,6 +487,22 @@ void on_get_processes(CPUState *env, GArray **out) {
  * @brief PPP callback to retrieve process handles from the running OS.
  */
 void on_get_process_handles(CPUState *env, GArray **out) {
+	if (cache_watch) {
+		GArray *ps = cached_processes(env);
+		g_array_free(*out, true);  // safe even when *out == NULL
+		*out = NULL;
+		if (ps == NULL) return;
+		*out = g_array_sized_new(false, false, sizeof(OsiProcHandle), ps->len);
+		g_array_set_clear_func(*out, (GDestroyNotify)free_osiprochandle_contents);
+		for (guint i = 0; i < ps->len; i++) {
+			OsiProc *p = &g_array_index(ps, OsiProc, i);
+			OsiProcHandle h;
+			h.taskd = p->taskd;
+			h.asid = p->asid;
+			g_array_append_val(*out, h);
+		}
+		return;
+	}
 	// instantiate and call function from get_process_info template
 	get_process_info<>(env, out, fill_osiprochandle, free_osiprochandle_contents);
 }
@@ -300,7 +513,9 @@ void on_get_process_handles(CPUState *env, GArray **out) {
 void on_get_current_process(CPUState *env, OsiProc **out) {
 	OsiProc *p = NULL;
 	target_ptr_t ts = kernel_profile->get_current_task_struct(env);
-	if (ts) {
+	if (ts && cache_enabled) {
+		p = copy_osiproc(cached_current_process(env, ts), NULL);
+	} else if (ts) {
 		p = (OsiProc *)g_malloc(sizeof(OsiProc));
 		fill_osiproc(env, p, ts);
 	}
@@ -344,6 +559,18 @@ void on_get_process(CPUState *env, const OsiProcHandle *h, OsiProc **out) {
  * @todo Remove duplicates from results.
  */
 void on_get_libraries(CPUState *env, OsiProc *p, GArray **out) {
+	if (cache_watch) {
+		g_array_free(*out, true);  // safe even when *out == NULL
+		*out = copy_osimods_g(cached_libraries(env, p));
+		return;
+	}
+	get_libraries(env, p, out);
+}
+
+/**
+ * @brief Reads the module list of \p p from the guest.
+ */
+static void get_libraries(CPUState *env, OsiProc *p, GArray **out) {
 	OsiModule m;
 	target_ptr_t vma_first, vma_current;
 
@@ -522,6 +749,8 @@ bool init_plugin(void *self) {
 	panda_arg_list *plugin_args = panda_get_args(PLUGIN_NAME);
 	char *kconf_file = g_strdup(panda_parse_string_req(plugin_args, "kconf_file", "file containing kernel configuration information"));
 	char *kconf_group = g_strdup(panda_parse_string_req(plugin_args, "kconf_group", "kernel profile to use"));
+	cache_watch = panda_parse_bool_opt(plugin_args, "cache_watch", "cache processes and module lists, invalidating them on kernel writes");
+	cache_enabled = panda_parse_bool_opt(plugin_args, "cache", "cache the current process until the next asid change (may miss exec and renames)") || cache_watch;
 	panda_free_args(plugin_args);
 
 	// Load kernel offsets.
@@ -546,6 +775,17 @@ bool init_plugin(void *self) {
 	PPP_REG_CB("osi", on_get_current_thread, on_get_current_thread);
 	PPP_REG_CB("osi", on_get_process_pid, on_get_process_pid);
 	PPP_REG_CB("osi", on_get_process_ppid, on_get_process_ppid);
+
+	if (cache_enabled) {
+		panda_cb pcb;
+		pcb.asid_changed = osi_cache_asid_changed;
+		panda_register_callback(self, PANDA_CB_ASID_CHANGED, pcb);
+		if (cache_watch) {
+			pcb.virt_mem_after_write = osi_cache_mem_write;
+			panda_register_callback(self, PANDA_CB_VIRT_MEM_AFTER_WRITE, pcb);
+			panda_enable_memcb();
+		}
+	}
 	LOG_INFO(PLUGIN_NAME " initialization complete.");
 	return true;
 #else
@@ -561,7 +801,7 @@ error:
  */
 void uninit_plugin(void *self) {
 #if defined(TARGET_I386) || defined(TARGET_ARM)
-	// Nothing to do...
+	cache_free();
 #endif
 	return;
 }
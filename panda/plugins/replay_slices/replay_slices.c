@@ -0,0 +1,208 @@
+/* PANDABEGINCOMMENT
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+ * PANDAENDCOMMENT */
+
+/*
+ * Replay a recording in n slices in parallel, using fork checkpoints.
+ *
+ * This process (the driver) replays the recording once, without analysis,
+ * and takes a fork checkpoint at the start of each slice. Once the
+ * checkpoint at the end of a slice exists, the slice is replayed from the
+ * one at its start in a new process (a worker), which loads the analysis
+ * plugins and stops at the end of its slice. No instruction is replayed
+ * more than twice, however many slices there are.
+ */
+
+#include <unistd.h>
+
+#include "panda/plugin.h"
+#include "panda/rr/rr_log.h"
+#include "panda/checkpoint.h"
+#include "panda/plog.h"
+#include "panda/plog-cc-bridge.h"
+
+bool init_plugin(void *);
+void uninit_plugin(void *);
+
+int before_block_exec(CPUState *env, TranslationBlock *tb);
+void after_init(CPUState *env);
+
+static uint32_t num_slices;
+static uint64_t *slice_starts;
+static Checkpoint **slice_checkpoints;
+static uint32_t next_checkpoint;
+static uint32_t next_spawn;
+static bool checkpoint_pending;
+static bool driver_done;
+
+static gchar **analysis_plugins;
+static const char *plog_prefix;
+
+// Processes holding a token may run a slice. The driver takes one before
+// resuming each worker, and the worker gives it back when it exits.
+static int jobs_pipe[2] = { -1, -1 };
+
+// Slice this process replays, -1 in the driver.
+static int worker_slice = -1;
+
+static void worker_release_job(void) {
+    char token = 0;
+    if (write(jobs_pipe[1], &token, 1) != 1) {
+        perror("replay_slices: write");
+    }
+}
+
+static void driver_acquire_job(void) {
+    char token;
+    ssize_t n;
+    do {
+        n = read(jobs_pipe[0], &token, 1);
+    } while (n < 0 && errno == EINTR);
+}
+
+static void slice_resumed(Checkpoint *checkpoint, uint64_t stop_instr_count) {
+    if (worker_slice >= 0) return;
+    for (uint32_t i = 0; i < num_slices; i++) {
+        if (slice_checkpoints[i] == checkpoint) worker_slice = i;
+    }
+    assert(worker_slice >= 0);
+    atexit(worker_release_job);
+
+    if (plog_prefix) {
+        gchar *path = g_strdup_printf("%s%d.plog", plog_prefix, worker_slice);
+        pandalog_cc_init_write(path);
+        pandalog = 1;
+        g_free(path);
+    }
+    for (int i = 0; analysis_plugins && analysis_plugins[i]; i++) {
+        if (analysis_plugins[i][0] == '\0') continue;
+        char *path = panda_plugin_path(analysis_plugins[i]);
+        if (!panda_load_plugin(path, analysis_plugins[i])) {
+            fprintf(stderr, "replay_slices: failed to load %s\n", path);
+            exit(1);
+        }
+        g_free(path);
+    }
+    // Blocks translated before the fork have no analysis instrumentation.
+    panda_do_flush_tb();
+
+    printf("replay_slices: slice %d [%lu, %lu)\n", worker_slice,
+            checkpoint->guest_instr_count, stop_instr_count);
+    fflush(stdout);
+}
+
+// Resume a worker for every slice whose end checkpoint exists.
+static void driver_spawn_ready(void) {
+    while (next_spawn < next_checkpoint) {
+        Checkpoint *start = slice_checkpoints[next_spawn];
+        uint64_t stop = 0;
+        if (next_spawn + 1 < num_slices) {
+            if (next_spawn + 1 >= next_checkpoint) return;
+            stop = slice_checkpoints[next_spawn + 1]->guest_instr_count;
+        }
+        driver_acquire_job();
+        if (panda_checkpoint_spawn(start, stop) < 0) {
+            fprintf(stderr, "replay_slices: cannot start slice %u\n",
+                    next_spawn);
+            worker_release_job();
+        }
+        next_spawn++;
+    }
+    if (next_spawn == num_slices) {
+        // Everything else is up to the workers.
+        driver_done = true;
+        panda_end_replay();
+    }
+}
+
+int before_block_exec(CPUState *env, TranslationBlock *tb) {
+    if (worker_slice >= 0 || driver_done) return 0;
+
+    if (checkpoint_pending) {
+        // The main loop has forked since the last block, or failed to.
+        checkpoint_pending = false;
+        Checkpoint *last = slice_checkpoints[next_checkpoint - 1];
+        if (last->fork_pid <= 0) {
+            fprintf(stderr, "replay_slices: no checkpoint for slice %u\n",
+                    next_checkpoint - 1);
+            driver_done = true;
+            panda_end_replay();
+            return 0;
+        }
+        driver_spawn_ready();
+    }
+
+    if (next_checkpoint < num_slices
+            && rr_get_guest_instr_count() >= slice_starts[next_checkpoint]) {
+        Checkpoint *checkpoint = panda_checkpoint();
+        if (checkpoint != NULL) {
+            slice_checkpoints[next_checkpoint++] = checkpoint;
+            checkpoint_pending = true;
+        }
+    }
+    return 0;
+}
+
+void after_init(CPUState *env) {
+    panda_arg_list *args = panda_get_args("replay_slices");
+    num_slices = panda_parse_uint32_opt(args, "n", 4, "Number of slices");
+    uint32_t jobs = panda_parse_uint32_opt(args, "jobs", num_slices,
+            "Number of slices to replay at once");
+    const char *plugins = panda_parse_string_opt(args, "plugins", "",
+            "Analysis plugins to load in each slice, separated by '+'");
+    plog_prefix = panda_parse_string_opt(args, "plog", NULL,
+            "Write a pandalog per slice, to <plog><slice>.plog");
+
+    if (!rr_in_replay()) {
+        fprintf(stderr, "replay_slices: only works in replay\n");
+        exit(1);
+    }
+    if (plog_prefix && pandalog) {
+        fprintf(stderr, "replay_slices: -pandalog and plog are exclusive\n");
+        exit(1);
+    }
+    if (num_slices == 0 || num_slices > MAX_CHECKPOINTS || jobs == 0) {
+        fprintf(stderr, "replay_slices: bad n or jobs\n");
+        exit(1);
+    }
+
+    uint64_t total = rr_nondet_log->last_prog_point.guest_instr_count;
+    slice_starts = g_new(uint64_t, num_slices);
+    slice_checkpoints = g_new0(Checkpoint *, num_slices);
+    for (uint32_t i = 0; i < num_slices; i++) {
+        slice_starts[i] = total * i / num_slices;
+    }
+    analysis_plugins = g_strsplit(plugins, "+", -1);
+
+    if (pipe(jobs_pipe) < 0) {
+        perror("replay_slices: pipe");
+        exit(1);
+    }
+    for (uint32_t i = 0; i < jobs; i++) {
+        worker_release_job();
+    }
+
+    checkpoint_fork = true;
+    panda_checkpoint_set_resume_hook(slice_resumed);
+    printf("replay_slices: %lu instructions, %u slices, %u at a time\n",
+            total, num_slices, jobs);
+}
+
+bool init_plugin(void *self) {
+    panda_cb pcb;
+    pcb.before_block_exec = before_block_exec;
+    panda_register_callback(self, PANDA_CB_BEFORE_BLOCK_EXEC, pcb);
+    pcb.after_machine_init = after_init;
+    panda_register_callback(self, PANDA_CB_AFTER_MACHINE_INIT, pcb);
+    return true;
+}
+
+void uninit_plugin(void *self) {
+    if (worker_slice >= 0) {
+        printf("replay_slices: slice %d done at %lu\n", worker_slice,
+                rr_get_guest_instr_count());
+    }
+}
@@ -10,6 +10,7 @@
 
 #include "panda/plugin.h"
 #include "panda/rr/rr_log.h"
+#include "panda/rr/rr_snapshot.h"
 
 #include "migration/migration.h"
 #include "include/exec/address-spaces.h"
@@ -35,6 +36,9 @@ static char *snp_name;
 
 static FILE *oldlog = NULL;
 static FILE *newlog = NULL;
+// set when the log being cut is block-compressed (v2); the new log is
+// always written in the v1 format.
+static RR_block_reader *oldlog_blocks = NULL;
 
 static RR_log_type rr_nondet_log_type;
 static unsigned long long rr_nondet_log_size;
@@ -66,11 +70,29 @@ static INLINEIT size_t rr_fwrite(void *ptr, size_t size, size_t nmemb, FILE *f)
 }
 
 static INLINEIT size_t rr_fread(void *ptr, size_t size, size_t nmemb, FILE *f) {
-    size_t result = fread(ptr, size, nmemb, f);
+    size_t result;
+    if (f == oldlog && oldlog_blocks) {
+        size_t len = size * nmemb;
+        result = rr_block_reader_read(oldlog_blocks, ptr, len) == len ? nmemb : 0;
+    } else {
+        result = fread(ptr, size, nmemb, f);
+    }
     sassert(result == nmemb, 2);
     return result;
 }
 
+static INLINEIT long oldlog_tell(void) {
+    return oldlog_blocks ? rr_block_reader_tell(oldlog_blocks) : ftell(oldlog);
+}
+
+static INLINEIT void oldlog_seek(long pos) {
+    if (oldlog_blocks) {
+        rr_block_reader_seek(oldlog_blocks, pos);
+    } else {
+        fseek(oldlog, pos, SEEK_SET);
+    }
+}
+
 static INLINEIT void rr_fcopy(void *ptr, size_t size, size_t nmemb, FILE *oldlog, FILE *newlog) {
     rr_fread(ptr, size, nmemb, oldlog);
     rr_fwrite(ptr, size, nmemb, newlog);
@@ -86,7 +108,7 @@ static INLINEIT RR_log_entry *alloc_new_entry(void)
 
 static INLINEIT bool rr_log_is_empty(void) {
     if (rr_nondet_log_type == REPLAY){
-        long pos = ftell(oldlog);
+        long pos = oldlog_tell();
         return pos == rr_nondet_log_size;
     } else {
         return false;
@@ -99,13 +121,13 @@ static RR_prog_point copy_entry(void) {
     // Copy entry.
     RR_log_entry *item = alloc_new_entry();
 
-    long pos = ftell(oldlog);
+    long pos = oldlog_tell();
 
     rr_fread(&(item->header.prog_point.guest_instr_count), sizeof(item->header.prog_point.guest_instr_count), 1, oldlog);
 
     if (item->header.prog_point.guest_instr_count > end_count) {
         // We don't want to copy this one.
-        fseek(oldlog, pos, SEEK_SET);
+        oldlog_seek(pos);
         return item->header.prog_point;
     }
 
@@ -222,7 +244,14 @@ static void start_snip(uint64_t count) {
     sassert((oldlog = fopen(rr_nondet_log->name, "r")), 8);
     rr_nondet_log_type = rr_nondet_log->type;
     rr_nondet_log_size = rr_nondet_log->size;
-    sassert(fread(&orig_last_prog_point, sizeof(RR_prog_point), 1, oldlog) == 1, 9);
+    if (rr_log_is_v2(oldlog)) {
+        oldlog_blocks = g_new0(RR_block_reader, 1);
+        sassert(rr_block_reader_init(oldlog_blocks, oldlog), 9);
+        orig_last_prog_point.guest_instr_count =
+            oldlog_blocks->header.last_instr_count;
+    } else {
+        sassert(fread(&orig_last_prog_point, sizeof(RR_prog_point), 1, oldlog) == 1, 9);
+    }
     printf("Original ending prog point: %" PRId64 "\n", (uint64_t) orig_last_prog_point.guest_instr_count);
 
     actual_start_count = count;
@@ -231,11 +260,7 @@ static void start_snip(uint64_t count) {
     // Force running state
     global_state_store_running();
     printf("writing snapshot:\t%s\n", snp_name);
-    QIOChannelFile* ioc =
-        qio_channel_file_new_path(snp_name, O_WRONLY | O_CREAT, 0660, NULL);
-    QEMUFile* snp = qemu_fopen_channel_output(QIO_CHANNEL(ioc));
-    qemu_savevm_state(snp, NULL);
-    qemu_fclose(snp);
+    rr_snapshot_save(snp_name, false);
     
     printf("Beginning cut-and-paste process at prog point: % " PRId64 "\n", (uint64_t) rr_get_guest_instr_count());
 
@@ -247,12 +272,12 @@ static void start_snip(uint64_t count) {
     fwrite(&prog_point.guest_instr_count,
            sizeof(prog_point.guest_instr_count), 1, newlog);
     
-    fseek(oldlog, ftell(rr_nondet_log->fp), SEEK_SET);
+    oldlog_seek(rr_nondet_log->bytes_read);
     
     // If there are items in the queue, then start copying the log
     // from there
     RR_log_entry *item = rr_get_queue_head();
-    if (item != NULL) fseek(oldlog, item->header.file_pos, SEEK_SET);
+    if (item != NULL) oldlog_seek(item->header.file_pos);
     
     //rw: For some reason I need to add an interrupt entry at the beginning of the log?
     RR_log_entry temp;
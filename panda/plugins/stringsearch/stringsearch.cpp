@@ -20,6 +20,7 @@ PANDAENDCOMMENT */
 #include <ctype.h>
 #include <math.h>
 #include <map>
+#include <vector>
 #include <fstream>
 #include <sstream>
 #include <string>
@@ -28,6 +29,7 @@ PANDAENDCOMMENT */
 #include "panda/plugin.h"
 
 extern "C" {
+#include "panda/plog.h"
 #include "stringsearch.h"
 }
 
@@ -50,15 +52,6 @@ PPP_PROT_REG_CB(on_ssm);
 
 }
 
-// Silly: since we use these as map values, they have to be
-// copy constructible. Plain arrays aren't, but structs containing
-// arrays are. So we make these goofy wrappers.
-struct match_strings {
-    int val[MAX_STRINGS];
-};
-struct string_pos {
-    uint32_t val[MAX_STRINGS];
-};
 struct fullstack {
     int n;
     target_ulong callers[MAX_CALLERS];
@@ -66,13 +59,182 @@ struct fullstack {
     target_ulong asid;
 };
 
+// All search strings compiled into one Aho-Corasick automaton, so the cost
+// per byte does not depend on the number of strings. Bytes that occur in no
+// string share a class, which keeps the transition table small: it has one
+// row per trie node and one column per class, and already includes the
+// failure transitions, so each byte is a single table lookup.
+class StringMatcher {
+  public:
+    std::vector<std::string> strings;
+
+    // Call after adding all strings.
+    void compile();
+
+    // Feed len bytes to a search in state *state, calling found(str_idx,
+    // i) for every string that ends at buf[i].
+    template <typename F>
+    void search(uint32_t *state, const uint8_t *buf, size_t len, F found) const
+    {
+        uint32_t st = *state;
+        for (size_t i = 0; i < len; i++) {
+            if (st == 0) {
+                // Skip bytes that cannot start a match.
+                i = skip_to_first(buf, i, len);
+                if (i == len) break;
+            }
+            st = delta[st * num_classes + byte_class[buf[i]]];
+            for (uint32_t out = report[st] ? st : 0; out != 0;
+                    out = out_link[out]) {
+                for (uint32_t str_idx : outputs[out]) {
+                    found(str_idx, i);
+                }
+            }
+        }
+        *state = st;
+    }
+
+  private:
+    // 0 for bytes in no string, up to 256 if every byte value occurs
+    uint16_t byte_class[256];
+    uint32_t num_classes;
+    uint8_t is_first[256];
+    int single_first; // the only first byte, or -1
+    std::vector<uint32_t> delta;
+    std::vector<std::vector<uint32_t>> outputs; // strings ending at a node
+    std::vector<uint32_t> out_link; // next node on the fail chain with outputs
+    std::vector<uint8_t> report;    // node or its out_link has outputs
+
+    size_t skip_to_first(const uint8_t *buf, size_t i, size_t len) const
+    {
+        if (single_first >= 0) {
+            const void *p = memchr(buf + i, single_first, len - i);
+            return p ? (const uint8_t *)p - buf : len;
+        }
+        while (i < len && !is_first[buf[i]]) i++;
+        return i;
+    }
+};
+
+void StringMatcher::compile()
+{
+    memset(byte_class, 0, sizeof(byte_class));
+    memset(is_first, 0, sizeof(is_first));
+    num_classes = 1; // class 0: bytes in no string
+    for (auto &str : strings) {
+        for (unsigned char c : str) {
+            if (!byte_class[c]) byte_class[c] = num_classes++;
+        }
+        is_first[(unsigned char)str[0]] = 1;
+    }
+    single_first = -1;
+    for (int c = 0; c < 256; c++) {
+        if (!is_first[c]) continue;
+        single_first = single_first == -1 ? c : -2;
+    }
+    if (single_first < 0) single_first = -1;
+
+    // Trie. Node 0 is the root; no edge leads back to it, so 0 in delta
+    // means no edge until the failure transitions are filled in.
+    delta.assign(num_classes, 0);
+    outputs.assign(1, std::vector<uint32_t>());
+    for (uint32_t str_idx = 0; str_idx < strings.size(); str_idx++) {
+        uint32_t node = 0;
+        for (unsigned char c : strings[str_idx]) {
+            uint32_t &next = delta[node * num_classes + byte_class[c]];
+            if (next == 0) {
+                next = outputs.size();
+                outputs.emplace_back();
+                delta.resize(delta.size() + num_classes, 0);
+            }
+            // delta may have moved; look the edge up again.
+            node = delta[node * num_classes + byte_class[c]];
+        }
+        outputs[node].push_back(str_idx);
+    }
+
+    // Failure links, breadth first, turning the trie into a DFA.
+    uint32_t num_nodes = outputs.size();
+    std::vector<uint32_t> fail(num_nodes, 0), queue;
+    out_link.assign(num_nodes, 0);
+    report.assign(num_nodes, 0);
+    queue.reserve(num_nodes);
+    for (uint32_t c = 0; c < num_classes; c++) {
+        if (delta[c]) queue.push_back(delta[c]);
+    }
+    for (size_t q = 0; q < queue.size(); q++) {
+        uint32_t node = queue[q];
+        uint32_t f = fail[node];
+        out_link[node] = outputs[f].empty() ? out_link[f] : f;
+        report[node] = !outputs[node].empty() || out_link[node];
+        for (uint32_t c = 0; c < num_classes; c++) {
+            uint32_t &next = delta[node * num_classes + c];
+            if (next) {
+                fail[next] = delta[f * num_classes + c];
+                queue.push_back(next);
+            } else {
+                next = delta[f * num_classes + c];
+            }
+        }
+    }
+    printf("stringsearch: %zu strings, %u automaton states, %u byte classes\n",
+           strings.size(), num_nodes, num_classes);
+}
+
+// Matcher state per tap point, in an open-addressing hash table.
+class TapStates {
+  public:
+    TapStates() : slots(1024), used(0) {}
+
+    uint32_t &operator[](const prog_point &p)
+    {
+        if (2 * (used + 1) > slots.size()) grow();
+        Slot &slot = find(slots, p);
+        if (!slot.used) {
+            slot.used = true;
+            slot.p = p;
+            slot.state = 0;
+            used++;
+        }
+        return slot.state;
+    }
+
+  private:
+    struct Slot {
+        prog_point p;
+        uint32_t state;
+        bool used;
+    };
+    std::vector<Slot> slots;
+    size_t used;
+
+    static Slot &find(std::vector<Slot> &table, const prog_point &p)
+    {
+        uint64_t h = ((uint64_t)p.pc * 0x9e3779b97f4a7c15ULL) ^
+                     ((uint64_t)p.caller * 0xc2b2ae3d27d4eb4fULL) ^
+                     (uint64_t)p.cr3;
+        h ^= h >> 29;
+        size_t mask = table.size() - 1;
+        for (size_t i = h & mask;; i = (i + 1) & mask) {
+            if (!table[i].used || table[i].p == p) return table[i];
+        }
+    }
+
+    void grow()
+    {
+        std::vector<Slot> bigger(2 * slots.size());
+        for (Slot &slot : slots) {
+            if (slot.used) find(bigger, slot.p) = slot;
+        }
+        slots.swap(bigger);
+    }
+};
+
 std::map<prog_point,fullstack> matchstacks;
-std::map<prog_point,match_strings> matches;
-std::map<prog_point,string_pos> read_text_tracker;
-std::map<prog_point,string_pos> write_text_tracker;
-uint8_t tofind[MAX_STRINGS][MAX_STRLEN];
-uint32_t strlens[MAX_STRINGS];
-int num_strings = 0;
+std::map<prog_point,std::vector<int>> matches;
+TapStates read_text_tracker;
+TapStates write_text_tracker;
+StringMatcher matcher;
 int n_callers = 16;
 
 // this creates BOTH the global for this callback fn (on_ssm_func)
@@ -83,51 +245,50 @@ PPP_CB_BOILERPLATE(on_ssm)
 
 int mem_callback(CPUState *env, target_ulong pc, target_ulong addr,
                        target_ulong size, void *buf, bool is_write,
-                       std::map<prog_point,string_pos> &text_tracker) {
+                       TapStates &text_tracker) {
     prog_point p = {};
     get_prog_point(env, &p);
 
-    string_pos &sp = text_tracker[p];
-
-    for (unsigned int i = 0; i < size; i++) {
-        uint8_t val = ((uint8_t *)buf)[i];
-        for(int str_idx = 0; str_idx < num_strings; str_idx++) {
-            if (tofind[str_idx][sp.val[str_idx]] == val)
-                sp.val[str_idx]++;
-            else
-                sp.val[str_idx] = 0;
-
-            if (sp.val[str_idx] == strlens[str_idx]) {
-                // Victory!
-                printf("%s Match of str %d at: instr_count=%lu :  " TARGET_FMT_lx " " TARGET_FMT_lx " " TARGET_FMT_lx "\n",
-                       (is_write ? "WRITE" : "READ"), str_idx, rr_get_guest_instr_count(), p.caller, p.pc, p.cr3);
-                matches[p].val[str_idx]++;
-                sp.val[str_idx] = 0;
-
-                // Also get the full stack here
-                fullstack f = {0};
-                f.n = get_callers(f.callers, n_callers, env);
-                f.pc = p.pc;
-                f.asid = p.cr3;
-                matchstacks[p] = f;
-
-                // Check if the full string is in memory.
-                uint8_t *tmp =
-                    (uint8_t *)calloc(strlens[str_idx] + 1, sizeof(*tmp));
-                target_ulong match_addr = (addr + i) - (strlens[str_idx] - 1);
-                panda_virtual_memory_read(env, match_addr, tmp,
-                                          strlens[str_idx]);
-                bool in_memory =
-                    memcmp(tmp, tofind[str_idx], strlens[str_idx]) == 0;
-                free(tmp);
-
-                // call the i-found-a-match registered callbacks here
-                PPP_RUN_CB(on_ssm, env, pc, in_memory ? match_addr : addr,
-                           tofind[str_idx], strlens[str_idx], is_write,
-                           in_memory);
-            }
+    uint32_t &sp = text_tracker[p];
+
+    matcher.search(&sp, (uint8_t *)buf, size, [&](uint32_t str_idx, size_t i) {
+        std::string &str = matcher.strings[str_idx];
+
+        // Victory!
+        printf("%s Match of str %d at: instr_count=%lu :  " TARGET_FMT_lx " " TARGET_FMT_lx " " TARGET_FMT_lx "\n",
+               (is_write ? "WRITE" : "READ"), str_idx, rr_get_guest_instr_count(), p.caller, p.pc, p.cr3);
+        if (pandalog) {
+            Panda__LogEntry ple = PANDA__LOG_ENTRY__INIT;
+            Panda__StringMatch sm = PANDA__STRING_MATCH__INIT;
+            sm.str_idx = str_idx;
+            sm.is_write = is_write;
+            sm.asid = p.cr3;
+            ple.string_match = &sm;
+            pandalog_write_entry(&ple);
         }
-    }
+        std::vector<int> &counts = matches[p];
+        counts.resize(matcher.strings.size());
+        counts[str_idx]++;
+
+        // Also get the full stack here
+        fullstack f = {0};
+        f.n = get_callers(f.callers, n_callers, env);
+        f.pc = p.pc;
+        f.asid = p.cr3;
+        matchstacks[p] = f;
+
+        // Check if the full string is in memory.
+        std::string tmp(str.size(), '\0');
+        target_ulong match_addr = (addr + i) - (str.size() - 1);
+        panda_virtual_memory_read(env, match_addr, (uint8_t *)&tmp[0],
+                                  str.size());
+        bool in_memory = tmp == str;
+
+        // call the i-found-a-match registered callbacks here
+        PPP_RUN_CB(on_ssm, env, pc, in_memory ? match_addr : addr,
+                   (uint8_t *)&str[0], str.size(), is_write,
+                   in_memory);
+    });
  
     return 1;
 }
@@ -153,11 +314,8 @@ bool init_plugin(void *self) {
     panda_arg_list *args = panda_get_args("stringsearch");
 
     const char *arg_str = panda_parse_string_opt(args, "str", "", "a single string to search for");
-    size_t arg_len = strlen(arg_str);
-    if (arg_len > 0) {
-        memcpy(tofind[num_strings], arg_str, arg_len);
-        strlens[num_strings] = arg_len;
-        num_strings++;
+    if (strlen(arg_str) > 0) {
+        matcher.strings.push_back(arg_str);
     }
 
     n_callers = panda_parse_uint64_opt(args, "callers", 16, "depth of callstack for matches");
@@ -182,33 +340,38 @@ bool init_plugin(void *self) {
         std::string line;
         while(std::getline(search_strings, line)) {
             std::istringstream iss(line);
+            std::string str;
 
             if (line[0] == '"') {
                 size_t len = line.size() - 2;
-                memcpy(tofind[num_strings], line.substr(1, len).c_str(), len);
-                strlens[num_strings] = len;
+                str = line.substr(1, len);
             } else {
                 std::string x;
-                int i = 0;
                 while (std::getline(iss, x, ':')) {
-                    tofind[num_strings][i++] = (uint8_t)strtoul(x.c_str(), NULL, 16);
-                    if (i >= MAX_STRLEN) {
-                        printf("WARN: Reached max number of characters (%d) on string %d, truncating.\n", MAX_STRLEN, num_strings);
+                    str.push_back((char)strtoul(x.c_str(), NULL, 16));
+                    if (str.size() >= MAX_STRLEN) {
+                        printf("WARN: Reached max number of characters (%d) on string %zu, truncating.\n", MAX_STRLEN, matcher.strings.size());
                         break;
                     }
                 }
-                strlens[num_strings] = i;
             }
+            if (str.empty()) continue;
 
-            printf("stringsearch: added string of length %d to search set\n", strlens[num_strings]);
+            // Don't flood the console when loading thousands of strings.
+            if (matcher.strings.size() < 100) {
+                printf("stringsearch: added string of length %zu to search set\n", str.size());
+            }
+            matcher.strings.push_back(str);
 
-            if(++num_strings >= MAX_STRINGS) {
+            if(matcher.strings.size() >= MAX_STRINGS) {
                 printf("WARN: maximum number of strings (%d) reached, will not load any more.\n", MAX_STRINGS);
                 break;
             }
         }
     }
 
+    matcher.compile();
+
     char matchfile[128] = {};
     sprintf(matchfile, "%s_string_matches.txt", prefix);
     mem_report = fopen(matchfile, "w");
@@ -235,7 +398,7 @@ bool init_plugin(void *self) {
 }
 
 void uninit_plugin(void *self) {
-    std::map<prog_point,match_strings>::iterator it;
+    std::map<prog_point,std::vector<int>>::iterator it;
     for(it = matches.begin(); it != matches.end(); it++) {
         // Print prog point
 
@@ -249,8 +412,9 @@ void uninit_plugin(void *self) {
         fprintf(mem_report, TARGET_FMT_lx " ", f.asid);
 
         // Print strings that matched and how many times
-        for(int i = 0; i < num_strings; i++)
-            fprintf(mem_report, " %d", it->second.val[i]);
+        it->second.resize(matcher.strings.size());
+        for(size_t i = 0; i < matcher.strings.size(); i++)
+            fprintf(mem_report, " %d", it->second[i]);
         fprintf(mem_report, "\n");
     }
     fclose(mem_report);
@@ -27,39 +27,49 @@ void syscall_enter_switch_{{os}}_{{arch}}(CPUState *cpu, target_ptr_t pc) {
 	syscall_ctx_t ctx = {};
 	ctx.no = {{arch_conf.rt_callno_reg}};
 	ctx.asid = panda_current_asid(cpu);
-	ctx.retaddr = calc_retaddr(cpu, pc);
 	bool panda_noreturn;	// true if PANDA should not track the return of this system call
+	bool return_cb;			// true if a callback for this system call's return is registered
 	const syscall_info_t *call = (syscall_meta == NULL || ctx.no > syscall_meta->max_generic) ? NULL : &syscall_info[ctx.no];
 
+	// Arguments are only read if a callback is going to see them.
 	switch (ctx.no) {
 	{%- for syscall in syscalls %}
 	// {{syscall.no}} {{syscall.rettype}} {{syscall.name}} {{syscall.args_raw}}
 	case {{syscall.no}}: {
 		panda_noreturn = {{ 'true' if syscall.panda_noreturn else 'false' }};
+		return_cb = PPP_CHECK_CB(on_{{syscall.name}}_return);
 		{%- if syscall.args|length > 0 %}
-		{%- for arg in syscall.args %}
-		{{arg.emit_temp_assignment()}}
-		{%- endfor %}
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_{{syscall.name}}_return)))) {
+		if (PPP_CHECK_CB(on_{{syscall.name}}_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			{%- for arg in syscall.args %}
+			{{arg.emit_temp_assignment()}}
+			{%- endfor %}
 			{%- for arg in syscall.args %}
 			{{arg.emit_memcpy_temp_to_ref()}}
 			{%- endfor %}
+			PPP_RUN_CB(on_{{syscall.name}}_enter, {{syscall.cargs}});
 		}
-		{%- endif %}
+		{%- else %}
 		PPP_RUN_CB(on_{{syscall.name}}_enter, {{syscall.cargs}});
+		{%- endif %}
 	}; break;
 	{%- endfor %}
 	default:
 		panda_noreturn = false;
+		return_cb = PPP_CHECK_CB(on_unknown_sys_return);
 		PPP_RUN_CB(on_unknown_sys_enter, cpu, pc, ctx.no);
 	} // switch (ctx.no)
 
+	// Only track the return if a callback is going to be told about it.
+	panda_noreturn = panda_noreturn || !(return_cb ||
+			PPP_CHECK_CB(on_all_sys_return) || PPP_CHECK_CB(on_all_sys_return2));
+	if (!panda_noreturn || PPP_CHECK_CB(on_all_sys_enter2)) {
+		ctx.retaddr = calc_retaddr(cpu, pc);
+	}
 	PPP_RUN_CB(on_all_sys_enter, cpu, pc, ctx.no);
 	PPP_RUN_CB(on_all_sys_enter2, cpu, pc, call, &ctx);
 	if (!panda_noreturn) {
-		running_syscalls[std::make_pair(ctx.retaddr, ctx.asid)] = ctx;
+		running_syscalls_add(&ctx);
 	}
 #endif
 }
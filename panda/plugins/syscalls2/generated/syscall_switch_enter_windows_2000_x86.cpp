@@ -27,46 +27,47 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 	syscall_ctx_t ctx = {};
 	ctx.no = env->regs[R_EAX];
 	ctx.asid = panda_current_asid(cpu);
-	ctx.retaddr = calc_retaddr(cpu, pc);
 	bool panda_noreturn;	// true if PANDA should not track the return of this system call
+	bool return_cb;			// true if a callback for this system call's return is registered
 	const syscall_info_t *call = (syscall_meta == NULL || ctx.no > syscall_meta->max_generic) ? NULL : &syscall_info[ctx.no];
 
+	// Arguments are only read if a callback is going to see them.
 	switch (ctx.no) {
 	// 0 NTSTATUS NtAcceptConnectPort ['PHANDLE PortHandle', 'PVOID PortContext', 'PPORT_MESSAGE ConnectionRequest', 'BOOLEAN AcceptConnection', 'PPORT_VIEW ServerView', 'PREMOTE_PORT_VIEW ClientView']
 	case 0: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtAcceptConnectPort_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtAcceptConnectPort_return);
+		if (PPP_CHECK_CB(on_NtAcceptConnectPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
 			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtAcceptConnectPort_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 		}
-		PPP_RUN_CB(on_NtAcceptConnectPort_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 	}; break;
 	// 1 NTSTATUS NtAccessCheck ['PSECURITY_DESCRIPTOR SecurityDescriptor', 'HANDLE ClientToken', 'ACCESS_MASK DesiredAccess', 'PGENERIC_MAPPING GenericMapping', 'PPRIVILEGE_SET PrivilegeSet', 'PULONG PrivilegeSetLength', 'PACCESS_MASK GrantedAccess', 'PNTSTATUS AccessStatus']
 	case 1: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtAccessCheck_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtAccessCheck_return);
+		if (PPP_CHECK_CB(on_NtAccessCheck_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
+			uint32_t arg7 = get_32(cpu, 7);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -75,26 +76,26 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
 			memcpy(ctx.args[6], &arg6, sizeof(uint32_t));
 			memcpy(ctx.args[7], &arg7, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtAccessCheck_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
 		}
-		PPP_RUN_CB(on_NtAccessCheck_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
 	}; break;
 	// 2 NTSTATUS NtAccessCheckAndAuditAlarm ['PUNICODE_STRING SubsystemName', 'PVOID HandleId', 'PUNICODE_STRING ObjectTypeName', 'PUNICODE_STRING ObjectName', 'PSECURITY_DESCRIPTOR SecurityDescriptor', 'ACCESS_MASK DesiredAccess', 'PGENERIC_MAPPING GenericMapping', 'BOOLEAN ObjectCreation', 'PACCESS_MASK GrantedAccess', 'PNTSTATUS AccessStatus', 'PBOOLEAN GenerateOnClose']
 	case 2: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_return);
+		if (PPP_CHECK_CB(on_NtAccessCheckAndAuditAlarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
+			uint32_t arg7 = get_32(cpu, 7);
+			uint32_t arg8 = get_32(cpu, 8);
+			uint32_t arg9 = get_32(cpu, 9);
+			uint32_t arg10 = get_32(cpu, 10);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -106,26 +107,26 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[8], &arg8, sizeof(uint32_t));
 			memcpy(ctx.args[9], &arg9, sizeof(uint32_t));
 			memcpy(ctx.args[10], &arg10, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtAccessCheckAndAuditAlarm_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
 		}
-		PPP_RUN_CB(on_NtAccessCheckAndAuditAlarm_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
 	}; break;
 	// 3 NTSTATUS NtAccessCheckByType ['PSECURITY_DESCRIPTOR SecurityDescriptor', 'PSID PrincipalSelfSid', 'HANDLE ClientToken', 'ACCESS_MASK DesiredAccess', 'POBJECT_TYPE_LIST ObjectTypeList', 'ULONG ObjectTypeListLength', 'PGENERIC_MAPPING GenericMapping', 'PPRIVILEGE_SET PrivilegeSet', 'PULONG PrivilegeSetLength', 'PACCESS_MASK GrantedAccess', 'PNTSTATUS AccessStatus']
 	case 3: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtAccessCheckByType_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtAccessCheckByType_return);
+		if (PPP_CHECK_CB(on_NtAccessCheckByType_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
+			uint32_t arg7 = get_32(cpu, 7);
+			uint32_t arg8 = get_32(cpu, 8);
+			uint32_t arg9 = get_32(cpu, 9);
+			uint32_t arg10 = get_32(cpu, 10);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -137,31 +138,31 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[8], &arg8, sizeof(uint32_t));
 			memcpy(ctx.args[9], &arg9, sizeof(uint32_t));
 			memcpy(ctx.args[10], &arg10, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtAccessCheckByType_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
 		}
-		PPP_RUN_CB(on_NtAccessCheckByType_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
 	}; break;
 	// 4 NTSTATUS NtAccessCheckByTypeAndAuditAlarm ['PUNICODE_STRING SubsystemName', 'PVOID HandleId', 'PUNICODE_STRING ObjectTypeName', 'PUNICODE_STRING ObjectName', 'PSECURITY_DESCRIPTOR SecurityDescriptor', 'PSID PrincipalSelfSid', 'ACCESS_MASK DesiredAccess', 'AUDIT_EVENT_TYPE AuditType', 'ULONG Flags', 'POBJECT_TYPE_LIST ObjectTypeList', 'ULONG ObjectTypeListLength', 'PGENERIC_MAPPING GenericMapping', 'BOOLEAN ObjectCreation', 'PACCESS_MASK GrantedAccess', 'PNTSTATUS AccessStatus', 'PBOOLEAN GenerateOnClose']
 	case 4: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		uint32_t arg11 = get_32(cpu, 11);
-		uint32_t arg12 = get_32(cpu, 12);
-		uint32_t arg13 = get_32(cpu, 13);
-		uint32_t arg14 = get_32(cpu, 14);
-		uint32_t arg15 = get_32(cpu, 15);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_return);
+		if (PPP_CHECK_CB(on_NtAccessCheckByTypeAndAuditAlarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
+			uint32_t arg7 = get_32(cpu, 7);
+			uint32_t arg8 = get_32(cpu, 8);
+			uint32_t arg9 = get_32(cpu, 9);
+			uint32_t arg10 = get_32(cpu, 10);
+			uint32_t arg11 = get_32(cpu, 11);
+			uint32_t arg12 = get_32(cpu, 12);
+			uint32_t arg13 = get_32(cpu, 13);
+			uint32_t arg14 = get_32(cpu, 14);
+			uint32_t arg15 = get_32(cpu, 15);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -178,26 +179,26 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[13], &arg13, sizeof(uint32_t));
 			memcpy(ctx.args[14], &arg14, sizeof(uint32_t));
 			memcpy(ctx.args[15], &arg15, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtAccessCheckByTypeAndAuditAlarm_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15);
 		}
-		PPP_RUN_CB(on_NtAccessCheckByTypeAndAuditAlarm_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15);
 	}; break;
 	// 5 NTSTATUS NtAccessCheckByTypeResultList ['PSECURITY_DESCRIPTOR SecurityDescriptor', 'PSID PrincipalSelfSid', 'HANDLE ClientToken', 'ACCESS_MASK DesiredAccess', 'POBJECT_TYPE_LIST ObjectTypeList', 'ULONG ObjectTypeListLength', 'PGENERIC_MAPPING GenericMapping', 'PPRIVILEGE_SET PrivilegeSet', 'PULONG PrivilegeSetLength', 'PACCESS_MASK GrantedAccess', 'PNTSTATUS AccessStatus']
 	case 5: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_return);
+		if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultList_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
+			uint32_t arg7 = get_32(cpu, 7);
+			uint32_t arg8 = get_32(cpu, 8);
+			uint32_t arg9 = get_32(cpu, 9);
+			uint32_t arg10 = get_32(cpu, 10);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -209,31 +210,31 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[8], &arg8, sizeof(uint32_t));
 			memcpy(ctx.args[9], &arg9, sizeof(uint32_t));
 			memcpy(ctx.args[10], &arg10, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtAccessCheckByTypeResultList_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
 		}
-		PPP_RUN_CB(on_NtAccessCheckByTypeResultList_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
 	}; break;
 	// 6 NTSTATUS NtAccessCheckByTypeResultListAndAuditAlarm ['PUNICODE_STRING SubsystemName', 'PVOID HandleId', 'PUNICODE_STRING ObjectTypeName', 'PUNICODE_STRING ObjectName', 'PSECURITY_DESCRIPTOR SecurityDescriptor', 'PSID PrincipalSelfSid', 'ACCESS_MASK DesiredAccess', 'AUDIT_EVENT_TYPE AuditType', 'ULONG Flags', 'POBJECT_TYPE_LIST ObjectTypeList', 'ULONG ObjectTypeListLength', 'PGENERIC_MAPPING GenericMapping', 'BOOLEAN ObjectCreation', 'PACCESS_MASK GrantedAccess', 'PNTSTATUS AccessStatus', 'PBOOLEAN GenerateOnClose']
 	case 6: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		uint32_t arg11 = get_32(cpu, 11);
-		uint32_t arg12 = get_32(cpu, 12);
-		uint32_t arg13 = get_32(cpu, 13);
-		uint32_t arg14 = get_32(cpu, 14);
-		uint32_t arg15 = get_32(cpu, 15);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_return);
+		if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
+			uint32_t arg7 = get_32(cpu, 7);
+			uint32_t arg8 = get_32(cpu, 8);
+			uint32_t arg9 = get_32(cpu, 9);
+			uint32_t arg10 = get_32(cpu, 10);
+			uint32_t arg11 = get_32(cpu, 11);
+			uint32_t arg12 = get_32(cpu, 12);
+			uint32_t arg13 = get_32(cpu, 13);
+			uint32_t arg14 = get_32(cpu, 14);
+			uint32_t arg15 = get_32(cpu, 15);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -250,32 +251,32 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[13], &arg13, sizeof(uint32_t));
 			memcpy(ctx.args[14], &arg14, sizeof(uint32_t));
 			memcpy(ctx.args[15], &arg15, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15);
 		}
-		PPP_RUN_CB(on_NtAccessCheckByTypeResultListAndAuditAlarm_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15);
 	}; break;
 	// 7 NTSTATUS NtAccessCheckByTypeResultListAndAuditAlarmByHandle ['PUNICODE_STRING SubsystemName', 'PVOID HandleId', 'HANDLE ClientToken', 'PUNICODE_STRING ObjectTypeName', 'PUNICODE_STRING ObjectName', 'PSECURITY_DESCRIPTOR SecurityDescriptor', 'PSID PrincipalSelfSid', 'ACCESS_MASK DesiredAccess', 'AUDIT_EVENT_TYPE AuditType', 'ULONG Flags', 'POBJECT_TYPE_LIST ObjectTypeList', 'ULONG ObjectTypeListLength', 'PGENERIC_MAPPING GenericMapping', 'BOOLEAN ObjectCreation', 'PACCESS_MASK GrantedAccess', 'PNTSTATUS AccessStatus', 'PBOOLEAN GenerateOnClose']
 	case 7: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		uint32_t arg11 = get_32(cpu, 11);
-		uint32_t arg12 = get_32(cpu, 12);
-		uint32_t arg13 = get_32(cpu, 13);
-		uint32_t arg14 = get_32(cpu, 14);
-		uint32_t arg15 = get_32(cpu, 15);
-		uint32_t arg16 = get_32(cpu, 16);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_return);
+		if (PPP_CHECK_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
+			uint32_t arg7 = get_32(cpu, 7);
+			uint32_t arg8 = get_32(cpu, 8);
+			uint32_t arg9 = get_32(cpu, 9);
+			uint32_t arg10 = get_32(cpu, 10);
+			uint32_t arg11 = get_32(cpu, 11);
+			uint32_t arg12 = get_32(cpu, 12);
+			uint32_t arg13 = get_32(cpu, 13);
+			uint32_t arg14 = get_32(cpu, 14);
+			uint32_t arg15 = get_32(cpu, 15);
+			uint32_t arg16 = get_32(cpu, 16);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -293,283 +294,283 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[14], &arg14, sizeof(uint32_t));
 			memcpy(ctx.args[15], &arg15, sizeof(uint32_t));
 			memcpy(ctx.args[16], &arg16, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16);
 		}
-		PPP_RUN_CB(on_NtAccessCheckByTypeResultListAndAuditAlarmByHandle_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14, arg15, arg16);
 	}; break;
 	// 8 NTSTATUS NtAddAtom ['PWSTR AtomName', 'ULONG Length', 'PRTL_ATOM Atom']
 	case 8: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtAddAtom_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtAddAtom_return);
+		if (PPP_CHECK_CB(on_NtAddAtom_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtAddAtom_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtAddAtom_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 9 NTSTATUS NtAdjustGroupsToken ['HANDLE TokenHandle', 'BOOLEAN ResetToDefault', 'PTOKEN_GROUPS NewState', 'ULONG BufferLength', 'PTOKEN_GROUPS PreviousState', 'PULONG ReturnLength']
 	case 9: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtAdjustGroupsToken_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtAdjustGroupsToken_return);
+		if (PPP_CHECK_CB(on_NtAdjustGroupsToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
 			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtAdjustGroupsToken_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 		}
-		PPP_RUN_CB(on_NtAdjustGroupsToken_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 	}; break;
 	// 10 NTSTATUS NtAdjustPrivilegesToken ['HANDLE TokenHandle', 'BOOLEAN DisableAllPrivileges', 'PTOKEN_PRIVILEGES NewState', 'ULONG BufferLength', 'PTOKEN_PRIVILEGES PreviousState', 'PULONG ReturnLength']
 	case 10: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtAdjustPrivilegesToken_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtAdjustPrivilegesToken_return);
+		if (PPP_CHECK_CB(on_NtAdjustPrivilegesToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
 			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtAdjustPrivilegesToken_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 		}
-		PPP_RUN_CB(on_NtAdjustPrivilegesToken_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 	}; break;
 	// 11 NTSTATUS NtAlertResumeThread ['HANDLE ThreadHandle', 'PULONG PreviousSuspendCount']
 	case 11: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtAlertResumeThread_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtAlertResumeThread_return);
+		if (PPP_CHECK_CB(on_NtAlertResumeThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtAlertResumeThread_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtAlertResumeThread_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 12 NTSTATUS NtAlertThread ['HANDLE ThreadHandle']
 	case 12: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtAlertThread_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtAlertThread_return);
+		if (PPP_CHECK_CB(on_NtAlertThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtAlertThread_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_NtAlertThread_enter, cpu, pc, arg0);
 	}; break;
 	// 13 NTSTATUS NtAllocateLocallyUniqueId ['PLUID Luid']
 	case 13: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_return);
+		if (PPP_CHECK_CB(on_NtAllocateLocallyUniqueId_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtAllocateLocallyUniqueId_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_NtAllocateLocallyUniqueId_enter, cpu, pc, arg0);
 	}; break;
 	// 14 NTSTATUS NtAllocateUserPhysicalPages ['HANDLE ProcessHandle', 'PULONG_PTR NumberOfPages', 'PULONG_PTR UserPfnArray']
 	case 14: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_return);
+		if (PPP_CHECK_CB(on_NtAllocateUserPhysicalPages_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtAllocateUserPhysicalPages_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtAllocateUserPhysicalPages_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 15 NTSTATUS NtAllocateUuids ['PULARGE_INTEGER Time', 'PULONG Range', 'PULONG Sequence', 'PCHAR Seed']
 	case 15: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtAllocateUuids_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtAllocateUuids_return);
+		if (PPP_CHECK_CB(on_NtAllocateUuids_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtAllocateUuids_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_NtAllocateUuids_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 16 NTSTATUS NtAllocateVirtualMemory ['HANDLE ProcessHandle', 'PVOID *BaseAddress', 'ULONG_PTR ZeroBits', 'PSIZE_T RegionSize', 'ULONG AllocationType', 'ULONG Protect']
 	case 16: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtAllocateVirtualMemory_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtAllocateVirtualMemory_return);
+		if (PPP_CHECK_CB(on_NtAllocateVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
 			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtAllocateVirtualMemory_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 		}
-		PPP_RUN_CB(on_NtAllocateVirtualMemory_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 	}; break;
 	// 17 NTSTATUS NtAreMappedFilesTheSame ['PVOID File1MappedAsAnImage', 'PVOID File2MappedAsFile']
 	case 17: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtAreMappedFilesTheSame_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtAreMappedFilesTheSame_return);
+		if (PPP_CHECK_CB(on_NtAreMappedFilesTheSame_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtAreMappedFilesTheSame_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtAreMappedFilesTheSame_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 18 NTSTATUS NtAssignProcessToJobObject ['HANDLE JobHandle', 'HANDLE ProcessHandle']
 	case 18: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtAssignProcessToJobObject_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtAssignProcessToJobObject_return);
+		if (PPP_CHECK_CB(on_NtAssignProcessToJobObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtAssignProcessToJobObject_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtAssignProcessToJobObject_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 19 NTSTATUS NtCallbackReturn ['PVOID OutputBuffer', 'ULONG OutputLength', 'NTSTATUS Status']
 	case 19: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtCallbackReturn_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtCallbackReturn_return);
+		if (PPP_CHECK_CB(on_NtCallbackReturn_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtCallbackReturn_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtCallbackReturn_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 20 NTSTATUS NtCancelIoFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock']
 	case 20: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtCancelIoFile_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtCancelIoFile_return);
+		if (PPP_CHECK_CB(on_NtCancelIoFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtCancelIoFile_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtCancelIoFile_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 21 NTSTATUS NtCancelTimer ['HANDLE TimerHandle', 'PBOOLEAN CurrentState']
 	case 21: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtCancelTimer_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtCancelTimer_return);
+		if (PPP_CHECK_CB(on_NtCancelTimer_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtCancelTimer_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtCancelTimer_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 23 NTSTATUS NtClearEvent ['HANDLE EventHandle']
 	case 23: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtClearEvent_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtClearEvent_return);
+		if (PPP_CHECK_CB(on_NtClearEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtClearEvent_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_NtClearEvent_enter, cpu, pc, arg0);
 	}; break;
 	// 24 NTSTATUS NtClose ['HANDLE Handle']
 	case 24: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtClose_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtClose_return);
+		if (PPP_CHECK_CB(on_NtClose_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtClose_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_NtClose_enter, cpu, pc, arg0);
 	}; break;
 	// 25 NTSTATUS NtCloseObjectAuditAlarm ['PUNICODE_STRING SubsystemName', 'PVOID HandleId', 'BOOLEAN GenerateOnClose']
 	case 25: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_return);
+		if (PPP_CHECK_CB(on_NtCloseObjectAuditAlarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtCloseObjectAuditAlarm_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtCloseObjectAuditAlarm_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 26 NTSTATUS NtCompleteConnectPort ['HANDLE PortHandle']
 	case 26: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtCompleteConnectPort_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtCompleteConnectPort_return);
+		if (PPP_CHECK_CB(on_NtCompleteConnectPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtCompleteConnectPort_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_NtCompleteConnectPort_enter, cpu, pc, arg0);
 	}; break;
 	// 27 NTSTATUS NtConnectPort ['PHANDLE PortHandle', 'PUNICODE_STRING PortName', 'PSECURITY_QUALITY_OF_SERVICE SecurityQos', 'PPORT_VIEW ClientView', 'PREMOTE_PORT_VIEW ServerView', 'PULONG MaxMessageLength', 'PVOID ConnectionInformation', 'PULONG ConnectionInformationLength']
 	case 27: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtConnectPort_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtConnectPort_return);
+		if (PPP_CHECK_CB(on_NtConnectPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
+			uint32_t arg7 = get_32(cpu, 7);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -578,88 +579,88 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
 			memcpy(ctx.args[6], &arg6, sizeof(uint32_t));
 			memcpy(ctx.args[7], &arg7, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtConnectPort_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
 		}
-		PPP_RUN_CB(on_NtConnectPort_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
 	}; break;
 	// 28 NTSTATUS NtContinue ['PCONTEXT ContextRecord', 'BOOLEAN TestAlert']
 	case 28: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtContinue_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtContinue_return);
+		if (PPP_CHECK_CB(on_NtContinue_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtContinue_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtContinue_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 29 NTSTATUS NtCreateDirectoryObject ['PHANDLE DirectoryHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 29: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtCreateDirectoryObject_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtCreateDirectoryObject_return);
+		if (PPP_CHECK_CB(on_NtCreateDirectoryObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtCreateDirectoryObject_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtCreateDirectoryObject_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 30 NTSTATUS NtCreateEvent ['PHANDLE EventHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'EVENT_TYPE EventType', 'BOOLEAN InitialState']
 	case 30: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtCreateEvent_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtCreateEvent_return);
+		if (PPP_CHECK_CB(on_NtCreateEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtCreateEvent_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtCreateEvent_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 31 NTSTATUS NtCreateEventPair ['PHANDLE EventPairHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 31: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtCreateEventPair_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtCreateEventPair_return);
+		if (PPP_CHECK_CB(on_NtCreateEventPair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtCreateEventPair_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtCreateEventPair_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 32 NTSTATUS NtCreateFile ['PHANDLE FileHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PIO_STATUS_BLOCK IoStatusBlock', 'PLARGE_INTEGER AllocationSize', 'ULONG FileAttributes', 'ULONG ShareAccess', 'ULONG CreateDisposition', 'ULONG CreateOptions', 'PVOID EaBuffer', 'ULONG EaLength']
 	case 32: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtCreateFile_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtCreateFile_return);
+		if (PPP_CHECK_CB(on_NtCreateFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
+			uint32_t arg7 = get_32(cpu, 7);
+			uint32_t arg8 = get_32(cpu, 8);
+			uint32_t arg9 = get_32(cpu, 9);
+			uint32_t arg10 = get_32(cpu, 10);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -671,54 +672,54 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[8], &arg8, sizeof(uint32_t));
 			memcpy(ctx.args[9], &arg9, sizeof(uint32_t));
 			memcpy(ctx.args[10], &arg10, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtCreateFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
 		}
-		PPP_RUN_CB(on_NtCreateFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
 	}; break;
 	// 33 NTSTATUS NtCreateIoCompletion ['PHANDLE IoCompletionHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'ULONG Count']
 	case 33: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtCreateIoCompletion_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtCreateIoCompletion_return);
+		if (PPP_CHECK_CB(on_NtCreateIoCompletion_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtCreateIoCompletion_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_NtCreateIoCompletion_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 34 NTSTATUS NtCreateJobObject ['PHANDLE JobHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 34: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtCreateJobObject_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtCreateJobObject_return);
+		if (PPP_CHECK_CB(on_NtCreateJobObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtCreateJobObject_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtCreateJobObject_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 35 NTSTATUS NtCreateKey ['PHANDLE KeyHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'ULONG TitleIndex', 'PUNICODE_STRING Class', 'ULONG CreateOptions', 'PULONG Disposition']
 	case 35: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtCreateKey_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtCreateKey_return);
+		if (PPP_CHECK_CB(on_NtCreateKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -726,23 +727,23 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
 			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
 			memcpy(ctx.args[6], &arg6, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtCreateKey_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
 		}
-		PPP_RUN_CB(on_NtCreateKey_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
 	}; break;
 	// 36 NTSTATUS NtCreateMailslotFile ['PHANDLE FileHandle', 'ULONG DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PIO_STATUS_BLOCK IoStatusBlock', 'ULONG CreateOptions', 'ULONG MailslotQuota', 'ULONG MaximumMessageSize', 'PLARGE_INTEGER ReadTimeout']
 	case 36: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtCreateMailslotFile_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtCreateMailslotFile_return);
+		if (PPP_CHECK_CB(on_NtCreateMailslotFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
+			uint32_t arg7 = get_32(cpu, 7);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -751,46 +752,46 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
 			memcpy(ctx.args[6], &arg6, sizeof(uint32_t));
 			memcpy(ctx.args[7], &arg7, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtCreateMailslotFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
 		}
-		PPP_RUN_CB(on_NtCreateMailslotFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
 	}; break;
 	// 37 NTSTATUS NtCreateMutant ['PHANDLE MutantHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'BOOLEAN InitialOwner']
 	case 37: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtCreateMutant_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtCreateMutant_return);
+		if (PPP_CHECK_CB(on_NtCreateMutant_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtCreateMutant_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_NtCreateMutant_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 38 NTSTATUS NtCreateNamedPipeFile ['PHANDLE FileHandle', 'ULONG DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PIO_STATUS_BLOCK IoStatusBlock', 'ULONG ShareAccess', 'ULONG CreateDisposition', 'ULONG CreateOptions', 'ULONG NamedPipeType', 'ULONG ReadMode', 'ULONG CompletionMode', 'ULONG MaximumInstances', 'ULONG InboundQuota', 'ULONG OutboundQuota', 'PLARGE_INTEGER DefaultTimeout']
 	case 38: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		uint32_t arg11 = get_32(cpu, 11);
-		uint32_t arg12 = get_32(cpu, 12);
-		uint32_t arg13 = get_32(cpu, 13);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtCreateNamedPipeFile_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtCreateNamedPipeFile_return);
+		if (PPP_CHECK_CB(on_NtCreateNamedPipeFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
+			uint32_t arg7 = get_32(cpu, 7);
+			uint32_t arg8 = get_32(cpu, 8);
+			uint32_t arg9 = get_32(cpu, 9);
+			uint32_t arg10 = get_32(cpu, 10);
+			uint32_t arg11 = get_32(cpu, 11);
+			uint32_t arg12 = get_32(cpu, 12);
+			uint32_t arg13 = get_32(cpu, 13);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -805,59 +806,59 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[11], &arg11, sizeof(uint32_t));
 			memcpy(ctx.args[12], &arg12, sizeof(uint32_t));
 			memcpy(ctx.args[13], &arg13, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtCreateNamedPipeFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13);
 		}
-		PPP_RUN_CB(on_NtCreateNamedPipeFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13);
 	}; break;
 	// 39 NTSTATUS NtCreatePagingFile ['PUNICODE_STRING PageFileName', 'PLARGE_INTEGER MinimumSize', 'PLARGE_INTEGER MaximumSize', 'ULONG Priority']
 	case 39: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtCreatePagingFile_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtCreatePagingFile_return);
+		if (PPP_CHECK_CB(on_NtCreatePagingFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtCreatePagingFile_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_NtCreatePagingFile_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 40 NTSTATUS NtCreatePort ['PHANDLE PortHandle', 'POBJECT_ATTRIBUTES ObjectAttributes', 'ULONG MaxConnectionInfoLength', 'ULONG MaxMessageLength', 'ULONG MaxPoolUsage']
 	case 40: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtCreatePort_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtCreatePort_return);
+		if (PPP_CHECK_CB(on_NtCreatePort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtCreatePort_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtCreatePort_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 41 NTSTATUS NtCreateProcess ['PHANDLE ProcessHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'HANDLE ParentProcess', 'BOOLEAN InheritObjectTable', 'HANDLE SectionHandle', 'HANDLE DebugPort', 'HANDLE ExceptionPort']
 	case 41: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtCreateProcess_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtCreateProcess_return);
+		if (PPP_CHECK_CB(on_NtCreateProcess_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
+			uint32_t arg7 = get_32(cpu, 7);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -866,24 +867,24 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
 			memcpy(ctx.args[6], &arg6, sizeof(uint32_t));
 			memcpy(ctx.args[7], &arg7, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtCreateProcess_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
 		}
-		PPP_RUN_CB(on_NtCreateProcess_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
 	}; break;
 	// 42 NTSTATUS NtCreateProfile ['PHANDLE ProfileHandle', 'HANDLE Process', 'PVOID RangeBase', 'SIZE_T RangeSize', 'ULONG BucketSize', 'PULONG Buffer', 'ULONG BufferSize', 'KPROFILE_SOURCE ProfileSource', 'KAFFINITY Affinity']
 	case 42: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtCreateProfile_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtCreateProfile_return);
+		if (PPP_CHECK_CB(on_NtCreateProfile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
+			uint32_t arg7 = get_32(cpu, 7);
+			uint32_t arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -893,22 +894,22 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[6], &arg6, sizeof(uint32_t));
 			memcpy(ctx.args[7], &arg7, sizeof(uint32_t));
 			memcpy(ctx.args[8], &arg8, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtCreateProfile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
 		}
-		PPP_RUN_CB(on_NtCreateProfile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
 	}; break;
 	// 43 NTSTATUS NtCreateSection ['PHANDLE SectionHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PLARGE_INTEGER MaximumSize', 'ULONG SectionPageProtection', 'ULONG AllocationAttributes', 'HANDLE FileHandle']
 	case 43: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtCreateSection_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtCreateSection_return);
+		if (PPP_CHECK_CB(on_NtCreateSection_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -916,59 +917,59 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
 			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
 			memcpy(ctx.args[6], &arg6, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtCreateSection_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
 		}
-		PPP_RUN_CB(on_NtCreateSection_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
 	}; break;
 	// 44 NTSTATUS NtCreateSemaphore ['PHANDLE SemaphoreHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'LONG InitialCount', 'LONG MaximumCount']
 	case 44: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		int32_t arg3 = get_s32(cpu, 3);
-		int32_t arg4 = get_s32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtCreateSemaphore_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtCreateSemaphore_return);
+		if (PPP_CHECK_CB(on_NtCreateSemaphore_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			int32_t arg3 = get_s32(cpu, 3);
+			int32_t arg4 = get_s32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(int32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(int32_t));
+			PPP_RUN_CB(on_NtCreateSemaphore_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtCreateSemaphore_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 45 NTSTATUS NtCreateSymbolicLinkObject ['PHANDLE LinkHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PUNICODE_STRING LinkTarget']
 	case 45: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_return);
+		if (PPP_CHECK_CB(on_NtCreateSymbolicLinkObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtCreateSymbolicLinkObject_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_NtCreateSymbolicLinkObject_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 46 NTSTATUS NtCreateThread ['PHANDLE ThreadHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'HANDLE ProcessHandle', 'PCLIENT_ID ClientId', 'PCONTEXT ThreadContext', 'PINITIAL_TEB InitialTeb', 'BOOLEAN CreateSuspended']
 	case 46: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtCreateThread_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtCreateThread_return);
+		if (PPP_CHECK_CB(on_NtCreateThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
+			uint32_t arg7 = get_32(cpu, 7);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -977,45 +978,45 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
 			memcpy(ctx.args[6], &arg6, sizeof(uint32_t));
 			memcpy(ctx.args[7], &arg7, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtCreateThread_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
 		}
-		PPP_RUN_CB(on_NtCreateThread_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
 	}; break;
 	// 47 NTSTATUS NtCreateTimer ['PHANDLE TimerHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'TIMER_TYPE TimerType']
 	case 47: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtCreateTimer_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtCreateTimer_return);
+		if (PPP_CHECK_CB(on_NtCreateTimer_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtCreateTimer_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_NtCreateTimer_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 48 NTSTATUS NtCreateToken ['PHANDLE TokenHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'TOKEN_TYPE TokenType', 'PLUID AuthenticationId', 'PLARGE_INTEGER ExpirationTime', 'PTOKEN_USER User', 'PTOKEN_GROUPS Groups', 'PTOKEN_PRIVILEGES Privileges', 'PTOKEN_OWNER Owner', 'PTOKEN_PRIMARY_GROUP PrimaryGroup', 'PTOKEN_DEFAULT_DACL DefaultDacl', 'PTOKEN_SOURCE TokenSource']
 	case 48: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		uint32_t arg11 = get_32(cpu, 11);
-		uint32_t arg12 = get_32(cpu, 12);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtCreateToken_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtCreateToken_return);
+		if (PPP_CHECK_CB(on_NtCreateToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
+			uint32_t arg7 = get_32(cpu, 7);
+			uint32_t arg8 = get_32(cpu, 8);
+			uint32_t arg9 = get_32(cpu, 9);
+			uint32_t arg10 = get_32(cpu, 10);
+			uint32_t arg11 = get_32(cpu, 11);
+			uint32_t arg12 = get_32(cpu, 12);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1029,118 +1030,118 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[10], &arg10, sizeof(uint32_t));
 			memcpy(ctx.args[11], &arg11, sizeof(uint32_t));
 			memcpy(ctx.args[12], &arg12, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtCreateToken_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12);
 		}
-		PPP_RUN_CB(on_NtCreateToken_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12);
 	}; break;
 	// 49 NTSTATUS NtCreateWaitablePort ['PHANDLE PortHandle', 'POBJECT_ATTRIBUTES ObjectAttributes', 'ULONG MaxConnectionInfoLength', 'ULONG MaxMessageLength', 'ULONG MaxPoolUsage']
 	case 49: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtCreateWaitablePort_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtCreateWaitablePort_return);
+		if (PPP_CHECK_CB(on_NtCreateWaitablePort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtCreateWaitablePort_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtCreateWaitablePort_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 50 NTSTATUS NtDelayExecution ['BOOLEAN Alertable', 'PLARGE_INTEGER DelayInterval']
 	case 50: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtDelayExecution_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtDelayExecution_return);
+		if (PPP_CHECK_CB(on_NtDelayExecution_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtDelayExecution_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtDelayExecution_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 51 NTSTATUS NtDeleteAtom ['RTL_ATOM Atom']
 	case 51: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtDeleteAtom_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtDeleteAtom_return);
+		if (PPP_CHECK_CB(on_NtDeleteAtom_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtDeleteAtom_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_NtDeleteAtom_enter, cpu, pc, arg0);
 	}; break;
 	// 52 NTSTATUS NtDeleteFile ['POBJECT_ATTRIBUTES ObjectAttributes']
 	case 52: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtDeleteFile_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtDeleteFile_return);
+		if (PPP_CHECK_CB(on_NtDeleteFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtDeleteFile_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_NtDeleteFile_enter, cpu, pc, arg0);
 	}; break;
 	// 53 NTSTATUS NtDeleteKey ['HANDLE KeyHandle']
 	case 53: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtDeleteKey_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtDeleteKey_return);
+		if (PPP_CHECK_CB(on_NtDeleteKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtDeleteKey_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_NtDeleteKey_enter, cpu, pc, arg0);
 	}; break;
 	// 54 NTSTATUS NtDeleteObjectAuditAlarm ['PUNICODE_STRING SubsystemName', 'PVOID HandleId', 'BOOLEAN GenerateOnClose']
 	case 54: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_return);
+		if (PPP_CHECK_CB(on_NtDeleteObjectAuditAlarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtDeleteObjectAuditAlarm_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtDeleteObjectAuditAlarm_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 55 NTSTATUS NtDeleteValueKey ['HANDLE KeyHandle', 'PUNICODE_STRING ValueName']
 	case 55: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtDeleteValueKey_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtDeleteValueKey_return);
+		if (PPP_CHECK_CB(on_NtDeleteValueKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtDeleteValueKey_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtDeleteValueKey_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 56 NTSTATUS NtDeviceIoControlFile ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'ULONG IoControlCode', 'PVOID InputBuffer', 'ULONG InputBufferLength', 'PVOID OutputBuffer', 'ULONG OutputBufferLength']
 	case 56: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtDeviceIoControlFile_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtDeviceIoControlFile_return);
+		if (PPP_CHECK_CB(on_NtDeviceIoControlFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
+			uint32_t arg7 = get_32(cpu, 7);
+			uint32_t arg8 = get_32(cpu, 8);
+			uint32_t arg9 = get_32(cpu, 9);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1151,33 +1152,33 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[7], &arg7, sizeof(uint32_t));
 			memcpy(ctx.args[8], &arg8, sizeof(uint32_t));
 			memcpy(ctx.args[9], &arg9, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtDeviceIoControlFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
 		}
-		PPP_RUN_CB(on_NtDeviceIoControlFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
 	}; break;
 	// 57 NTSTATUS NtDisplayString ['PUNICODE_STRING String']
 	case 57: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtDisplayString_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtDisplayString_return);
+		if (PPP_CHECK_CB(on_NtDisplayString_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtDisplayString_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_NtDisplayString_enter, cpu, pc, arg0);
 	}; break;
 	// 58 NTSTATUS NtDuplicateObject ['HANDLE SourceProcessHandle', 'HANDLE SourceHandle', 'HANDLE TargetProcessHandle', 'PHANDLE TargetHandle', 'ACCESS_MASK DesiredAccess', 'ULONG HandleAttributes', 'ULONG Options']
 	case 58: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtDuplicateObject_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtDuplicateObject_return);
+		if (PPP_CHECK_CB(on_NtDuplicateObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1185,230 +1186,231 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
 			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
 			memcpy(ctx.args[6], &arg6, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtDuplicateObject_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
 		}
-		PPP_RUN_CB(on_NtDuplicateObject_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
 	}; break;
 	// 59 NTSTATUS NtDuplicateToken ['HANDLE ExistingTokenHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'BOOLEAN EffectiveOnly', 'TOKEN_TYPE TokenType', 'PHANDLE NewTokenHandle']
 	case 59: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtDuplicateToken_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtDuplicateToken_return);
+		if (PPP_CHECK_CB(on_NtDuplicateToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
 			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtDuplicateToken_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 		}
-		PPP_RUN_CB(on_NtDuplicateToken_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 	}; break;
 	// 60 NTSTATUS NtEnumerateKey ['HANDLE KeyHandle', 'ULONG Index', 'KEY_INFORMATION_CLASS KeyInformationClass', 'PVOID KeyInformation', 'ULONG Length', 'PULONG ResultLength']
 	case 60: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtEnumerateKey_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtEnumerateKey_return);
+		if (PPP_CHECK_CB(on_NtEnumerateKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
 			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtEnumerateKey_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 		}
-		PPP_RUN_CB(on_NtEnumerateKey_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 	}; break;
 	// 61 NTSTATUS NtEnumerateValueKey ['HANDLE KeyHandle', 'ULONG Index', 'KEY_VALUE_INFORMATION_CLASS KeyValueInformationClass', 'PVOID KeyValueInformation', 'ULONG Length', 'PULONG ResultLength']
 	case 61: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtEnumerateValueKey_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtEnumerateValueKey_return);
+		if (PPP_CHECK_CB(on_NtEnumerateValueKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
 			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtEnumerateValueKey_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 		}
-		PPP_RUN_CB(on_NtEnumerateValueKey_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 	}; break;
 	// 62 NTSTATUS NtExtendSection ['HANDLE SectionHandle', 'PLARGE_INTEGER NewSectionSize']
 	case 62: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtExtendSection_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtExtendSection_return);
+		if (PPP_CHECK_CB(on_NtExtendSection_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtExtendSection_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtExtendSection_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 63 NTSTATUS NtFilterToken ['HANDLE ExistingTokenHandle', 'ULONG Flags', 'PTOKEN_GROUPS SidsToDisable', 'PTOKEN_PRIVILEGES PrivilegesToDelete', 'PTOKEN_GROUPS RestrictedSids', 'PHANDLE NewTokenHandle']
 	case 63: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtFilterToken_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtFilterToken_return);
+		if (PPP_CHECK_CB(on_NtFilterToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
 			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtFilterToken_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 		}
-		PPP_RUN_CB(on_NtFilterToken_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 	}; break;
 	// 64 NTSTATUS NtFindAtom ['PWSTR AtomName', 'ULONG Length', 'PRTL_ATOM Atom']
 	case 64: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtFindAtom_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtFindAtom_return);
+		if (PPP_CHECK_CB(on_NtFindAtom_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtFindAtom_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtFindAtom_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 65 NTSTATUS NtFlushBuffersFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock']
 	case 65: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtFlushBuffersFile_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtFlushBuffersFile_return);
+		if (PPP_CHECK_CB(on_NtFlushBuffersFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtFlushBuffersFile_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtFlushBuffersFile_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 66 NTSTATUS NtFlushInstructionCache ['HANDLE ProcessHandle', 'PVOID BaseAddress', 'SIZE_T Length']
 	case 66: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtFlushInstructionCache_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtFlushInstructionCache_return);
+		if (PPP_CHECK_CB(on_NtFlushInstructionCache_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtFlushInstructionCache_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtFlushInstructionCache_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 67 NTSTATUS NtFlushKey ['HANDLE KeyHandle']
 	case 67: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtFlushKey_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtFlushKey_return);
+		if (PPP_CHECK_CB(on_NtFlushKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtFlushKey_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_NtFlushKey_enter, cpu, pc, arg0);
 	}; break;
 	// 68 NTSTATUS NtFlushVirtualMemory ['HANDLE ProcessHandle', 'PVOID *BaseAddress', 'PSIZE_T RegionSize', 'PIO_STATUS_BLOCK IoStatus']
 	case 68: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtFlushVirtualMemory_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtFlushVirtualMemory_return);
+		if (PPP_CHECK_CB(on_NtFlushVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtFlushVirtualMemory_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_NtFlushVirtualMemory_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 69 NTSTATUS NtFlushWriteBuffer ['']
 	case 69: {
 		panda_noreturn = false;
+		return_cb = PPP_CHECK_CB(on_NtFlushWriteBuffer_return);
 		PPP_RUN_CB(on_NtFlushWriteBuffer_enter, cpu, pc);
 	}; break;
 	// 70 NTSTATUS NtFreeUserPhysicalPages ['HANDLE ProcessHandle', 'PULONG_PTR NumberOfPages', 'PULONG_PTR UserPfnArray']
 	case 70: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtFreeUserPhysicalPages_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtFreeUserPhysicalPages_return);
+		if (PPP_CHECK_CB(on_NtFreeUserPhysicalPages_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtFreeUserPhysicalPages_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtFreeUserPhysicalPages_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 71 NTSTATUS NtFreeVirtualMemory ['HANDLE ProcessHandle', 'PVOID *BaseAddress', 'PSIZE_T RegionSize', 'ULONG FreeType']
 	case 71: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtFreeVirtualMemory_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtFreeVirtualMemory_return);
+		if (PPP_CHECK_CB(on_NtFreeVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtFreeVirtualMemory_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_NtFreeVirtualMemory_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 72 NTSTATUS NtFsControlFile ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'ULONG IoControlCode', 'PVOID InputBuffer', 'ULONG InputBufferLength', 'PVOID OutputBuffer', 'ULONG OutputBufferLength']
 	case 72: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtFsControlFile_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtFsControlFile_return);
+		if (PPP_CHECK_CB(on_NtFsControlFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
+			uint32_t arg7 = get_32(cpu, 7);
+			uint32_t arg8 = get_32(cpu, 8);
+			uint32_t arg9 = get_32(cpu, 9);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1419,65 +1421,65 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[7], &arg7, sizeof(uint32_t));
 			memcpy(ctx.args[8], &arg8, sizeof(uint32_t));
 			memcpy(ctx.args[9], &arg9, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtFsControlFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
 		}
-		PPP_RUN_CB(on_NtFsControlFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
 	}; break;
 	// 73 NTSTATUS NtGetContextThread ['HANDLE ThreadHandle', 'PCONTEXT ThreadContext']
 	case 73: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtGetContextThread_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtGetContextThread_return);
+		if (PPP_CHECK_CB(on_NtGetContextThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtGetContextThread_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtGetContextThread_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 74 NTSTATUS NtGetDevicePowerState ['HANDLE Device', 'DEVICE_POWER_STATE *State']
 	case 74: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtGetDevicePowerState_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtGetDevicePowerState_return);
+		if (PPP_CHECK_CB(on_NtGetDevicePowerState_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtGetDevicePowerState_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtGetDevicePowerState_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 75 NTSTATUS NtGetPlugPlayEvent ['HANDLE EventHandle', 'PVOID Context', 'PPLUGPLAY_EVENT_BLOCK EventBlock', 'ULONG EventBufferSize']
 	case 75: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtGetPlugPlayEvent_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtGetPlugPlayEvent_return);
+		if (PPP_CHECK_CB(on_NtGetPlugPlayEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtGetPlugPlayEvent_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_NtGetPlugPlayEvent_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 77 NTSTATUS NtGetWriteWatch ['HANDLE ProcessHandle', 'ULONG Flags', 'PVOID BaseAddress', 'SIZE_T RegionSize', 'PVOID *UserAddressArray', 'PULONG_PTR EntriesInUserAddressArray', 'PULONG Granularity']
 	case 77: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtGetWriteWatch_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtGetWriteWatch_return);
+		if (PPP_CHECK_CB(on_NtGetWriteWatch_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1485,149 +1487,150 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
 			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
 			memcpy(ctx.args[6], &arg6, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtGetWriteWatch_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
 		}
-		PPP_RUN_CB(on_NtGetWriteWatch_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
 	}; break;
 	// 78 NTSTATUS NtImpersonateAnonymousToken ['HANDLE ThreadHandle']
 	case 78: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtImpersonateAnonymousToken_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtImpersonateAnonymousToken_return);
+		if (PPP_CHECK_CB(on_NtImpersonateAnonymousToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtImpersonateAnonymousToken_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_NtImpersonateAnonymousToken_enter, cpu, pc, arg0);
 	}; break;
 	// 79 NTSTATUS NtImpersonateClientOfPort ['HANDLE PortHandle', 'PPORT_MESSAGE Message']
 	case 79: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtImpersonateClientOfPort_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtImpersonateClientOfPort_return);
+		if (PPP_CHECK_CB(on_NtImpersonateClientOfPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtImpersonateClientOfPort_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtImpersonateClientOfPort_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 80 NTSTATUS NtImpersonateThread ['HANDLE ServerThreadHandle', 'HANDLE ClientThreadHandle', 'PSECURITY_QUALITY_OF_SERVICE SecurityQos']
 	case 80: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtImpersonateThread_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtImpersonateThread_return);
+		if (PPP_CHECK_CB(on_NtImpersonateThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtImpersonateThread_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtImpersonateThread_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 81 NTSTATUS NtInitializeRegistry ['USHORT BootCondition']
 	case 81: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtInitializeRegistry_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtInitializeRegistry_return);
+		if (PPP_CHECK_CB(on_NtInitializeRegistry_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtInitializeRegistry_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_NtInitializeRegistry_enter, cpu, pc, arg0);
 	}; break;
 	// 82 NTSTATUS NtInitiatePowerAction ['POWER_ACTION SystemAction', 'SYSTEM_POWER_STATE MinSystemState', 'ULONG Flags', 'BOOLEAN Asynchronous']
 	case 82: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtInitiatePowerAction_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtInitiatePowerAction_return);
+		if (PPP_CHECK_CB(on_NtInitiatePowerAction_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtInitiatePowerAction_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_NtInitiatePowerAction_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 83 BOOLEAN NtIsSystemResumeAutomatic ['']
 	case 83: {
 		panda_noreturn = false;
+		return_cb = PPP_CHECK_CB(on_NtIsSystemResumeAutomatic_return);
 		PPP_RUN_CB(on_NtIsSystemResumeAutomatic_enter, cpu, pc);
 	}; break;
 	// 84 NTSTATUS NtListenPort ['HANDLE PortHandle', 'PPORT_MESSAGE ConnectionRequest']
 	case 84: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtListenPort_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtListenPort_return);
+		if (PPP_CHECK_CB(on_NtListenPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtListenPort_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtListenPort_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 85 NTSTATUS NtLoadDriver ['PUNICODE_STRING DriverServiceName']
 	case 85: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtLoadDriver_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtLoadDriver_return);
+		if (PPP_CHECK_CB(on_NtLoadDriver_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtLoadDriver_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_NtLoadDriver_enter, cpu, pc, arg0);
 	}; break;
 	// 86 NTSTATUS NtLoadKey ['POBJECT_ATTRIBUTES TargetKey', 'POBJECT_ATTRIBUTES SourceFile']
 	case 86: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtLoadKey_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtLoadKey_return);
+		if (PPP_CHECK_CB(on_NtLoadKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtLoadKey_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtLoadKey_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 87 NTSTATUS NtLoadKey2 ['POBJECT_ATTRIBUTES TargetKey', 'POBJECT_ATTRIBUTES SourceFile', 'ULONG Flags']
 	case 87: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtLoadKey2_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtLoadKey2_return);
+		if (PPP_CHECK_CB(on_NtLoadKey2_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtLoadKey2_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtLoadKey2_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 88 NTSTATUS NtLockFile ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'PLARGE_INTEGER ByteOffset', 'PLARGE_INTEGER Length', 'ULONG Key', 'BOOLEAN FailImmediately', 'BOOLEAN ExclusiveLock']
 	case 88: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtLockFile_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtLockFile_return);
+		if (PPP_CHECK_CB(on_NtLockFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
+			uint32_t arg7 = get_32(cpu, 7);
+			uint32_t arg8 = get_32(cpu, 8);
+			uint32_t arg9 = get_32(cpu, 9);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1638,83 +1641,83 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[7], &arg7, sizeof(uint32_t));
 			memcpy(ctx.args[8], &arg8, sizeof(uint32_t));
 			memcpy(ctx.args[9], &arg9, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtLockFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
 		}
-		PPP_RUN_CB(on_NtLockFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
 	}; break;
 	// 89 NTSTATUS NtLockVirtualMemory ['HANDLE ProcessHandle', 'PVOID *BaseAddress', 'PSIZE_T RegionSize', 'ULONG MapType']
 	case 89: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtLockVirtualMemory_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtLockVirtualMemory_return);
+		if (PPP_CHECK_CB(on_NtLockVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtLockVirtualMemory_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_NtLockVirtualMemory_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 90 NTSTATUS NtMakeTemporaryObject ['HANDLE Handle']
 	case 90: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtMakeTemporaryObject_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtMakeTemporaryObject_return);
+		if (PPP_CHECK_CB(on_NtMakeTemporaryObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtMakeTemporaryObject_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_NtMakeTemporaryObject_enter, cpu, pc, arg0);
 	}; break;
 	// 91 NTSTATUS NtMapUserPhysicalPages ['PVOID VirtualAddress', 'ULONG_PTR NumberOfPages', 'PULONG_PTR UserPfnArray']
 	case 91: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtMapUserPhysicalPages_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtMapUserPhysicalPages_return);
+		if (PPP_CHECK_CB(on_NtMapUserPhysicalPages_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtMapUserPhysicalPages_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtMapUserPhysicalPages_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 92 NTSTATUS NtMapUserPhysicalPagesScatter ['PVOID *VirtualAddresses', 'ULONG_PTR NumberOfPages', 'PULONG_PTR UserPfnArray']
 	case 92: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_return);
+		if (PPP_CHECK_CB(on_NtMapUserPhysicalPagesScatter_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtMapUserPhysicalPagesScatter_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtMapUserPhysicalPagesScatter_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 93 NTSTATUS NtMapViewOfSection ['HANDLE SectionHandle', 'HANDLE ProcessHandle', 'PVOID *BaseAddress', 'ULONG_PTR ZeroBits', 'SIZE_T CommitSize', 'PLARGE_INTEGER SectionOffset', 'PSIZE_T ViewSize', 'SECTION_INHERIT InheritDisposition', 'ULONG AllocationType', 'WIN32_PROTECTION_MASK Win32Protect']
 	case 93: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtMapViewOfSection_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtMapViewOfSection_return);
+		if (PPP_CHECK_CB(on_NtMapViewOfSection_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
+			uint32_t arg7 = get_32(cpu, 7);
+			uint32_t arg8 = get_32(cpu, 8);
+			uint32_t arg9 = get_32(cpu, 9);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1725,24 +1728,24 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[7], &arg7, sizeof(uint32_t));
 			memcpy(ctx.args[8], &arg8, sizeof(uint32_t));
 			memcpy(ctx.args[9], &arg9, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtMapViewOfSection_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
 		}
-		PPP_RUN_CB(on_NtMapViewOfSection_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
 	}; break;
 	// 94 NTSTATUS NtNotifyChangeDirectoryFile ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID Buffer', 'ULONG Length', 'ULONG CompletionFilter', 'BOOLEAN WatchTree']
 	case 94: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_return);
+		if (PPP_CHECK_CB(on_NtNotifyChangeDirectoryFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
+			uint32_t arg7 = get_32(cpu, 7);
+			uint32_t arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1752,25 +1755,25 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[6], &arg6, sizeof(uint32_t));
 			memcpy(ctx.args[7], &arg7, sizeof(uint32_t));
 			memcpy(ctx.args[8], &arg8, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtNotifyChangeDirectoryFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
 		}
-		PPP_RUN_CB(on_NtNotifyChangeDirectoryFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
 	}; break;
 	// 95 NTSTATUS NtNotifyChangeKey ['HANDLE KeyHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'ULONG CompletionFilter', 'BOOLEAN WatchTree', 'PVOID Buffer', 'ULONG BufferSize', 'BOOLEAN Asynchronous']
 	case 95: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtNotifyChangeKey_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtNotifyChangeKey_return);
+		if (PPP_CHECK_CB(on_NtNotifyChangeKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
+			uint32_t arg7 = get_32(cpu, 7);
+			uint32_t arg8 = get_32(cpu, 8);
+			uint32_t arg9 = get_32(cpu, 9);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1781,27 +1784,27 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[7], &arg7, sizeof(uint32_t));
 			memcpy(ctx.args[8], &arg8, sizeof(uint32_t));
 			memcpy(ctx.args[9], &arg9, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtNotifyChangeKey_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
 		}
-		PPP_RUN_CB(on_NtNotifyChangeKey_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
 	}; break;
 	// 96 NTSTATUS NtNotifyChangeMultipleKeys ['HANDLE MasterKeyHandle', 'ULONG Count', 'OBJECT_ATTRIBUTES SlaveObjects[]', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'ULONG CompletionFilter', 'BOOLEAN WatchTree', 'PVOID Buffer', 'ULONG BufferSize', 'BOOLEAN Asynchronous']
 	case 96: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		uint32_t arg11 = get_32(cpu, 11);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_return);
+		if (PPP_CHECK_CB(on_NtNotifyChangeMultipleKeys_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
+			uint32_t arg7 = get_32(cpu, 7);
+			uint32_t arg8 = get_32(cpu, 8);
+			uint32_t arg9 = get_32(cpu, 9);
+			uint32_t arg10 = get_32(cpu, 10);
+			uint32_t arg11 = get_32(cpu, 11);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1814,153 +1817,153 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[9], &arg9, sizeof(uint32_t));
 			memcpy(ctx.args[10], &arg10, sizeof(uint32_t));
 			memcpy(ctx.args[11], &arg11, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtNotifyChangeMultipleKeys_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11);
 		}
-		PPP_RUN_CB(on_NtNotifyChangeMultipleKeys_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11);
 	}; break;
 	// 97 NTSTATUS NtOpenDirectoryObject ['PHANDLE DirectoryHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 97: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtOpenDirectoryObject_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtOpenDirectoryObject_return);
+		if (PPP_CHECK_CB(on_NtOpenDirectoryObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtOpenDirectoryObject_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtOpenDirectoryObject_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 98 NTSTATUS NtOpenEvent ['PHANDLE EventHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 98: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtOpenEvent_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtOpenEvent_return);
+		if (PPP_CHECK_CB(on_NtOpenEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtOpenEvent_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtOpenEvent_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 99 NTSTATUS NtOpenEventPair ['PHANDLE EventPairHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 99: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtOpenEventPair_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtOpenEventPair_return);
+		if (PPP_CHECK_CB(on_NtOpenEventPair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtOpenEventPair_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtOpenEventPair_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 100 NTSTATUS NtOpenFile ['PHANDLE FileHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PIO_STATUS_BLOCK IoStatusBlock', 'ULONG ShareAccess', 'ULONG OpenOptions']
 	case 100: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtOpenFile_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtOpenFile_return);
+		if (PPP_CHECK_CB(on_NtOpenFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
 			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtOpenFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 		}
-		PPP_RUN_CB(on_NtOpenFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 	}; break;
 	// 101 NTSTATUS NtOpenIoCompletion ['PHANDLE IoCompletionHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 101: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtOpenIoCompletion_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtOpenIoCompletion_return);
+		if (PPP_CHECK_CB(on_NtOpenIoCompletion_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtOpenIoCompletion_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtOpenIoCompletion_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 102 NTSTATUS NtOpenJobObject ['PHANDLE JobHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 102: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtOpenJobObject_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtOpenJobObject_return);
+		if (PPP_CHECK_CB(on_NtOpenJobObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtOpenJobObject_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtOpenJobObject_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 103 NTSTATUS NtOpenKey ['PHANDLE KeyHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 103: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtOpenKey_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtOpenKey_return);
+		if (PPP_CHECK_CB(on_NtOpenKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtOpenKey_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtOpenKey_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 104 NTSTATUS NtOpenMutant ['PHANDLE MutantHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 104: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtOpenMutant_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtOpenMutant_return);
+		if (PPP_CHECK_CB(on_NtOpenMutant_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtOpenMutant_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtOpenMutant_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 105 NTSTATUS NtOpenObjectAuditAlarm ['PUNICODE_STRING SubsystemName', 'PVOID HandleId', 'PUNICODE_STRING ObjectTypeName', 'PUNICODE_STRING ObjectName', 'PSECURITY_DESCRIPTOR SecurityDescriptor', 'HANDLE ClientToken', 'ACCESS_MASK DesiredAccess', 'ACCESS_MASK GrantedAccess', 'PPRIVILEGE_SET Privileges', 'BOOLEAN ObjectCreation', 'BOOLEAN AccessGranted', 'PBOOLEAN GenerateOnClose']
 	case 105: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		uint32_t arg11 = get_32(cpu, 11);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_return);
+		if (PPP_CHECK_CB(on_NtOpenObjectAuditAlarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
+			uint32_t arg7 = get_32(cpu, 7);
+			uint32_t arg8 = get_32(cpu, 8);
+			uint32_t arg9 = get_32(cpu, 9);
+			uint32_t arg10 = get_32(cpu, 10);
+			uint32_t arg11 = get_32(cpu, 11);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -1973,329 +1976,329 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[9], &arg9, sizeof(uint32_t));
 			memcpy(ctx.args[10], &arg10, sizeof(uint32_t));
 			memcpy(ctx.args[11], &arg11, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtOpenObjectAuditAlarm_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11);
 		}
-		PPP_RUN_CB(on_NtOpenObjectAuditAlarm_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11);
 	}; break;
 	// 106 NTSTATUS NtOpenProcess ['PHANDLE ProcessHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PCLIENT_ID ClientId']
 	case 106: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtOpenProcess_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtOpenProcess_return);
+		if (PPP_CHECK_CB(on_NtOpenProcess_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtOpenProcess_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_NtOpenProcess_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 107 NTSTATUS NtOpenProcessToken ['HANDLE ProcessHandle', 'ACCESS_MASK DesiredAccess', 'PHANDLE TokenHandle']
 	case 107: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtOpenProcessToken_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtOpenProcessToken_return);
+		if (PPP_CHECK_CB(on_NtOpenProcessToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtOpenProcessToken_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtOpenProcessToken_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 108 NTSTATUS NtOpenSection ['PHANDLE SectionHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 108: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtOpenSection_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtOpenSection_return);
+		if (PPP_CHECK_CB(on_NtOpenSection_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtOpenSection_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtOpenSection_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 109 NTSTATUS NtOpenSemaphore ['PHANDLE SemaphoreHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 109: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtOpenSemaphore_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtOpenSemaphore_return);
+		if (PPP_CHECK_CB(on_NtOpenSemaphore_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtOpenSemaphore_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtOpenSemaphore_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 110 NTSTATUS NtOpenSymbolicLinkObject ['PHANDLE LinkHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 110: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_return);
+		if (PPP_CHECK_CB(on_NtOpenSymbolicLinkObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtOpenSymbolicLinkObject_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtOpenSymbolicLinkObject_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 111 NTSTATUS NtOpenThread ['PHANDLE ThreadHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes', 'PCLIENT_ID ClientId']
 	case 111: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtOpenThread_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtOpenThread_return);
+		if (PPP_CHECK_CB(on_NtOpenThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtOpenThread_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_NtOpenThread_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 112 NTSTATUS NtOpenThreadToken ['HANDLE ThreadHandle', 'ACCESS_MASK DesiredAccess', 'BOOLEAN OpenAsSelf', 'PHANDLE TokenHandle']
 	case 112: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtOpenThreadToken_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtOpenThreadToken_return);
+		if (PPP_CHECK_CB(on_NtOpenThreadToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtOpenThreadToken_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_NtOpenThreadToken_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 113 NTSTATUS NtOpenTimer ['PHANDLE TimerHandle', 'ACCESS_MASK DesiredAccess', 'POBJECT_ATTRIBUTES ObjectAttributes']
 	case 113: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtOpenTimer_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtOpenTimer_return);
+		if (PPP_CHECK_CB(on_NtOpenTimer_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtOpenTimer_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtOpenTimer_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 114 NTSTATUS NtPlugPlayControl ['PLUGPLAY_CONTROL_CLASS PnPControlClass', 'PVOID PnPControlData', 'ULONG PnPControlDataLength']
 	case 114: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtPlugPlayControl_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtPlugPlayControl_return);
+		if (PPP_CHECK_CB(on_NtPlugPlayControl_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtPlugPlayControl_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtPlugPlayControl_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 115 NTSTATUS NtPowerInformation ['POWER_INFORMATION_LEVEL InformationLevel', 'PVOID InputBuffer', 'ULONG InputBufferLength', 'PVOID OutputBuffer', 'ULONG OutputBufferLength']
 	case 115: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtPowerInformation_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtPowerInformation_return);
+		if (PPP_CHECK_CB(on_NtPowerInformation_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtPowerInformation_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtPowerInformation_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 116 NTSTATUS NtPrivilegeCheck ['HANDLE ClientToken', 'PPRIVILEGE_SET RequiredPrivileges', 'PBOOLEAN Result']
 	case 116: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtPrivilegeCheck_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtPrivilegeCheck_return);
+		if (PPP_CHECK_CB(on_NtPrivilegeCheck_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtPrivilegeCheck_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtPrivilegeCheck_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 117 NTSTATUS NtPrivilegedServiceAuditAlarm ['PUNICODE_STRING SubsystemName', 'PUNICODE_STRING ServiceName', 'HANDLE ClientToken', 'PPRIVILEGE_SET Privileges', 'BOOLEAN AccessGranted']
 	case 117: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_return);
+		if (PPP_CHECK_CB(on_NtPrivilegedServiceAuditAlarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtPrivilegedServiceAuditAlarm_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtPrivilegedServiceAuditAlarm_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 118 NTSTATUS NtPrivilegeObjectAuditAlarm ['PUNICODE_STRING SubsystemName', 'PVOID HandleId', 'HANDLE ClientToken', 'ACCESS_MASK DesiredAccess', 'PPRIVILEGE_SET Privileges', 'BOOLEAN AccessGranted']
 	case 118: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_return);
+		if (PPP_CHECK_CB(on_NtPrivilegeObjectAuditAlarm_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
 			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtPrivilegeObjectAuditAlarm_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 		}
-		PPP_RUN_CB(on_NtPrivilegeObjectAuditAlarm_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 	}; break;
 	// 119 NTSTATUS NtProtectVirtualMemory ['HANDLE ProcessHandle', 'PVOID *BaseAddress', 'PSIZE_T RegionSize', 'WIN32_PROTECTION_MASK NewProtectWin32', 'PULONG OldProtect']
 	case 119: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtProtectVirtualMemory_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtProtectVirtualMemory_return);
+		if (PPP_CHECK_CB(on_NtProtectVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtProtectVirtualMemory_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtProtectVirtualMemory_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 120 NTSTATUS NtPulseEvent ['HANDLE EventHandle', 'PLONG PreviousState']
 	case 120: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtPulseEvent_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtPulseEvent_return);
+		if (PPP_CHECK_CB(on_NtPulseEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtPulseEvent_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtPulseEvent_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 121 NTSTATUS NtQueryInformationAtom ['RTL_ATOM Atom', 'ATOM_INFORMATION_CLASS InformationClass', 'PVOID AtomInformation', 'ULONG AtomInformationLength', 'PULONG ReturnLength']
 	case 121: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQueryInformationAtom_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQueryInformationAtom_return);
+		if (PPP_CHECK_CB(on_NtQueryInformationAtom_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQueryInformationAtom_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtQueryInformationAtom_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 122 NTSTATUS NtQueryAttributesFile ['POBJECT_ATTRIBUTES ObjectAttributes', 'PFILE_BASIC_INFORMATION FileInformation']
 	case 122: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQueryAttributesFile_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQueryAttributesFile_return);
+		if (PPP_CHECK_CB(on_NtQueryAttributesFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQueryAttributesFile_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtQueryAttributesFile_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 123 NTSTATUS NtQueryDefaultLocale ['BOOLEAN UserProfile', 'PLCID DefaultLocaleId']
 	case 123: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQueryDefaultLocale_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQueryDefaultLocale_return);
+		if (PPP_CHECK_CB(on_NtQueryDefaultLocale_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQueryDefaultLocale_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtQueryDefaultLocale_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 124 NTSTATUS NtQueryDefaultUILanguage ['LANGID *DefaultUILanguageId']
 	case 124: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQueryDefaultUILanguage_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQueryDefaultUILanguage_return);
+		if (PPP_CHECK_CB(on_NtQueryDefaultUILanguage_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQueryDefaultUILanguage_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_NtQueryDefaultUILanguage_enter, cpu, pc, arg0);
 	}; break;
 	// 125 NTSTATUS NtQueryDirectoryFile ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID FileInformation', 'ULONG Length', 'FILE_INFORMATION_CLASS FileInformationClass', 'BOOLEAN ReturnSingleEntry', 'PUNICODE_STRING FileName', 'BOOLEAN RestartScan']
 	case 125: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		uint32_t arg9 = get_32(cpu, 9);
-		uint32_t arg10 = get_32(cpu, 10);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQueryDirectoryFile_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQueryDirectoryFile_return);
+		if (PPP_CHECK_CB(on_NtQueryDirectoryFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
+			uint32_t arg7 = get_32(cpu, 7);
+			uint32_t arg8 = get_32(cpu, 8);
+			uint32_t arg9 = get_32(cpu, 9);
+			uint32_t arg10 = get_32(cpu, 10);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2307,22 +2310,22 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[8], &arg8, sizeof(uint32_t));
 			memcpy(ctx.args[9], &arg9, sizeof(uint32_t));
 			memcpy(ctx.args[10], &arg10, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQueryDirectoryFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
 		}
-		PPP_RUN_CB(on_NtQueryDirectoryFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
 	}; break;
 	// 126 NTSTATUS NtQueryDirectoryObject ['HANDLE DirectoryHandle', 'PVOID Buffer', 'ULONG Length', 'BOOLEAN ReturnSingleEntry', 'BOOLEAN RestartScan', 'PULONG Context', 'PULONG ReturnLength']
 	case 126: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQueryDirectoryObject_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQueryDirectoryObject_return);
+		if (PPP_CHECK_CB(on_NtQueryDirectoryObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2330,24 +2333,24 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
 			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
 			memcpy(ctx.args[6], &arg6, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQueryDirectoryObject_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
 		}
-		PPP_RUN_CB(on_NtQueryDirectoryObject_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
 	}; break;
 	// 127 NTSTATUS NtQueryEaFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID Buffer', 'ULONG Length', 'BOOLEAN ReturnSingleEntry', 'PVOID EaList', 'ULONG EaListLength', 'PULONG EaIndex', 'BOOLEAN RestartScan']
 	case 127: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQueryEaFile_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQueryEaFile_return);
+		if (PPP_CHECK_CB(on_NtQueryEaFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
+			uint32_t arg7 = get_32(cpu, 7);
+			uint32_t arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2357,317 +2360,317 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[6], &arg6, sizeof(uint32_t));
 			memcpy(ctx.args[7], &arg7, sizeof(uint32_t));
 			memcpy(ctx.args[8], &arg8, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQueryEaFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
 		}
-		PPP_RUN_CB(on_NtQueryEaFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
 	}; break;
 	// 128 NTSTATUS NtQueryEvent ['HANDLE EventHandle', 'EVENT_INFORMATION_CLASS EventInformationClass', 'PVOID EventInformation', 'ULONG EventInformationLength', 'PULONG ReturnLength']
 	case 128: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQueryEvent_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQueryEvent_return);
+		if (PPP_CHECK_CB(on_NtQueryEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQueryEvent_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtQueryEvent_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 129 NTSTATUS NtQueryFullAttributesFile ['POBJECT_ATTRIBUTES ObjectAttributes', 'PFILE_NETWORK_OPEN_INFORMATION FileInformation']
 	case 129: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQueryFullAttributesFile_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQueryFullAttributesFile_return);
+		if (PPP_CHECK_CB(on_NtQueryFullAttributesFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQueryFullAttributesFile_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtQueryFullAttributesFile_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 130 NTSTATUS NtQueryInformationFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID FileInformation', 'ULONG Length', 'FILE_INFORMATION_CLASS FileInformationClass']
 	case 130: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQueryInformationFile_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQueryInformationFile_return);
+		if (PPP_CHECK_CB(on_NtQueryInformationFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQueryInformationFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtQueryInformationFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 131 NTSTATUS NtQueryInformationJobObject ['HANDLE JobHandle', 'JOBOBJECTINFOCLASS JobObjectInformationClass', 'PVOID JobObjectInformation', 'ULONG JobObjectInformationLength', 'PULONG ReturnLength']
 	case 131: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQueryInformationJobObject_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQueryInformationJobObject_return);
+		if (PPP_CHECK_CB(on_NtQueryInformationJobObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQueryInformationJobObject_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtQueryInformationJobObject_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 132 NTSTATUS NtQueryIoCompletion ['HANDLE IoCompletionHandle', 'IO_COMPLETION_INFORMATION_CLASS IoCompletionInformationClass', 'PVOID IoCompletionInformation', 'ULONG IoCompletionInformationLength', 'PULONG ReturnLength']
 	case 132: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQueryIoCompletion_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQueryIoCompletion_return);
+		if (PPP_CHECK_CB(on_NtQueryIoCompletion_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQueryIoCompletion_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtQueryIoCompletion_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 133 NTSTATUS NtQueryInformationPort ['HANDLE PortHandle', 'PORT_INFORMATION_CLASS PortInformationClass', 'PVOID PortInformation', 'ULONG Length', 'PULONG ReturnLength']
 	case 133: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQueryInformationPort_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQueryInformationPort_return);
+		if (PPP_CHECK_CB(on_NtQueryInformationPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQueryInformationPort_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtQueryInformationPort_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 134 NTSTATUS NtQueryInformationProcess ['HANDLE ProcessHandle', 'PROCESSINFOCLASS ProcessInformationClass', 'PVOID ProcessInformation', 'ULONG ProcessInformationLength', 'PULONG ReturnLength']
 	case 134: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQueryInformationProcess_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQueryInformationProcess_return);
+		if (PPP_CHECK_CB(on_NtQueryInformationProcess_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQueryInformationProcess_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtQueryInformationProcess_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 135 NTSTATUS NtQueryInformationThread ['HANDLE ThreadHandle', 'THREADINFOCLASS ThreadInformationClass', 'PVOID ThreadInformation', 'ULONG ThreadInformationLength', 'PULONG ReturnLength']
 	case 135: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQueryInformationThread_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQueryInformationThread_return);
+		if (PPP_CHECK_CB(on_NtQueryInformationThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQueryInformationThread_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtQueryInformationThread_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 136 NTSTATUS NtQueryInformationToken ['HANDLE TokenHandle', 'TOKEN_INFORMATION_CLASS TokenInformationClass', 'PVOID TokenInformation', 'ULONG TokenInformationLength', 'PULONG ReturnLength']
 	case 136: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQueryInformationToken_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQueryInformationToken_return);
+		if (PPP_CHECK_CB(on_NtQueryInformationToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQueryInformationToken_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtQueryInformationToken_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 137 NTSTATUS NtQueryInstallUILanguage ['LANGID *InstallUILanguageId']
 	case 137: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQueryInstallUILanguage_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQueryInstallUILanguage_return);
+		if (PPP_CHECK_CB(on_NtQueryInstallUILanguage_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQueryInstallUILanguage_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_NtQueryInstallUILanguage_enter, cpu, pc, arg0);
 	}; break;
 	// 138 NTSTATUS NtQueryIntervalProfile ['KPROFILE_SOURCE ProfileSource', 'PULONG Interval']
 	case 138: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQueryIntervalProfile_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQueryIntervalProfile_return);
+		if (PPP_CHECK_CB(on_NtQueryIntervalProfile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQueryIntervalProfile_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtQueryIntervalProfile_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 139 NTSTATUS NtQueryKey ['HANDLE KeyHandle', 'KEY_INFORMATION_CLASS KeyInformationClass', 'PVOID KeyInformation', 'ULONG Length', 'PULONG ResultLength']
 	case 139: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQueryKey_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQueryKey_return);
+		if (PPP_CHECK_CB(on_NtQueryKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQueryKey_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtQueryKey_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 140 NTSTATUS NtQueryMultipleValueKey ['HANDLE KeyHandle', 'PKEY_VALUE_ENTRY ValueEntries', 'ULONG EntryCount', 'PVOID ValueBuffer', 'PULONG BufferLength', 'PULONG RequiredBufferLength']
 	case 140: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQueryMultipleValueKey_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQueryMultipleValueKey_return);
+		if (PPP_CHECK_CB(on_NtQueryMultipleValueKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
 			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQueryMultipleValueKey_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 		}
-		PPP_RUN_CB(on_NtQueryMultipleValueKey_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 	}; break;
 	// 141 NTSTATUS NtQueryMutant ['HANDLE MutantHandle', 'MUTANT_INFORMATION_CLASS MutantInformationClass', 'PVOID MutantInformation', 'ULONG MutantInformationLength', 'PULONG ReturnLength']
 	case 141: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQueryMutant_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQueryMutant_return);
+		if (PPP_CHECK_CB(on_NtQueryMutant_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQueryMutant_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtQueryMutant_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 142 NTSTATUS NtQueryObject ['HANDLE Handle', 'OBJECT_INFORMATION_CLASS ObjectInformationClass', 'PVOID ObjectInformation', 'ULONG ObjectInformationLength', 'PULONG ReturnLength']
 	case 142: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQueryObject_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQueryObject_return);
+		if (PPP_CHECK_CB(on_NtQueryObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQueryObject_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtQueryObject_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 143 NTSTATUS NtQueryOpenSubKeys ['POBJECT_ATTRIBUTES TargetKey', 'PULONG HandleCount']
 	case 143: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQueryOpenSubKeys_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQueryOpenSubKeys_return);
+		if (PPP_CHECK_CB(on_NtQueryOpenSubKeys_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQueryOpenSubKeys_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtQueryOpenSubKeys_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 144 NTSTATUS NtQueryPerformanceCounter ['PLARGE_INTEGER PerformanceCounter', 'PLARGE_INTEGER PerformanceFrequency']
 	case 144: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQueryPerformanceCounter_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQueryPerformanceCounter_return);
+		if (PPP_CHECK_CB(on_NtQueryPerformanceCounter_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQueryPerformanceCounter_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtQueryPerformanceCounter_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 145 NTSTATUS NtQueryQuotaInformationFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID Buffer', 'ULONG Length', 'BOOLEAN ReturnSingleEntry', 'PVOID SidList', 'ULONG SidListLength', 'PULONG StartSid', 'BOOLEAN RestartScan']
 	case 145: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQueryQuotaInformationFile_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQueryQuotaInformationFile_return);
+		if (PPP_CHECK_CB(on_NtQueryQuotaInformationFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
+			uint32_t arg7 = get_32(cpu, 7);
+			uint32_t arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2677,291 +2680,291 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[6], &arg6, sizeof(uint32_t));
 			memcpy(ctx.args[7], &arg7, sizeof(uint32_t));
 			memcpy(ctx.args[8], &arg8, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQueryQuotaInformationFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
 		}
-		PPP_RUN_CB(on_NtQueryQuotaInformationFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
 	}; break;
 	// 146 NTSTATUS NtQuerySection ['HANDLE SectionHandle', 'SECTION_INFORMATION_CLASS SectionInformationClass', 'PVOID SectionInformation', 'SIZE_T SectionInformationLength', 'PSIZE_T ReturnLength']
 	case 146: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQuerySection_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQuerySection_return);
+		if (PPP_CHECK_CB(on_NtQuerySection_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQuerySection_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtQuerySection_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 147 NTSTATUS NtQuerySecurityObject ['HANDLE Handle', 'SECURITY_INFORMATION SecurityInformation', 'PSECURITY_DESCRIPTOR SecurityDescriptor', 'ULONG Length', 'PULONG LengthNeeded']
 	case 147: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQuerySecurityObject_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQuerySecurityObject_return);
+		if (PPP_CHECK_CB(on_NtQuerySecurityObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQuerySecurityObject_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtQuerySecurityObject_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 148 NTSTATUS NtQuerySemaphore ['HANDLE SemaphoreHandle', 'SEMAPHORE_INFORMATION_CLASS SemaphoreInformationClass', 'PVOID SemaphoreInformation', 'ULONG SemaphoreInformationLength', 'PULONG ReturnLength']
 	case 148: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQuerySemaphore_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQuerySemaphore_return);
+		if (PPP_CHECK_CB(on_NtQuerySemaphore_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQuerySemaphore_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtQuerySemaphore_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 149 NTSTATUS NtQuerySymbolicLinkObject ['HANDLE LinkHandle', 'PUNICODE_STRING LinkTarget', 'PULONG ReturnedLength']
 	case 149: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_return);
+		if (PPP_CHECK_CB(on_NtQuerySymbolicLinkObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQuerySymbolicLinkObject_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtQuerySymbolicLinkObject_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 150 NTSTATUS NtQuerySystemEnvironmentValue ['PUNICODE_STRING VariableName', 'PWSTR VariableValue', 'USHORT ValueLength', 'PUSHORT ReturnLength']
 	case 150: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_return);
+		if (PPP_CHECK_CB(on_NtQuerySystemEnvironmentValue_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQuerySystemEnvironmentValue_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_NtQuerySystemEnvironmentValue_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 151 NTSTATUS NtQuerySystemInformation ['SYSTEM_INFORMATION_CLASS SystemInformationClass', 'PVOID SystemInformation', 'ULONG SystemInformationLength', 'PULONG ReturnLength']
 	case 151: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQuerySystemInformation_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQuerySystemInformation_return);
+		if (PPP_CHECK_CB(on_NtQuerySystemInformation_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQuerySystemInformation_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_NtQuerySystemInformation_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 152 NTSTATUS NtQuerySystemTime ['PLARGE_INTEGER SystemTime']
 	case 152: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQuerySystemTime_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQuerySystemTime_return);
+		if (PPP_CHECK_CB(on_NtQuerySystemTime_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQuerySystemTime_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_NtQuerySystemTime_enter, cpu, pc, arg0);
 	}; break;
 	// 153 NTSTATUS NtQueryTimer ['HANDLE TimerHandle', 'TIMER_INFORMATION_CLASS TimerInformationClass', 'PVOID TimerInformation', 'ULONG TimerInformationLength', 'PULONG ReturnLength']
 	case 153: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQueryTimer_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQueryTimer_return);
+		if (PPP_CHECK_CB(on_NtQueryTimer_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQueryTimer_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtQueryTimer_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 154 NTSTATUS NtQueryTimerResolution ['PULONG MaximumTime', 'PULONG MinimumTime', 'PULONG CurrentTime']
 	case 154: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQueryTimerResolution_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQueryTimerResolution_return);
+		if (PPP_CHECK_CB(on_NtQueryTimerResolution_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQueryTimerResolution_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtQueryTimerResolution_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 155 NTSTATUS NtQueryValueKey ['HANDLE KeyHandle', 'PUNICODE_STRING ValueName', 'KEY_VALUE_INFORMATION_CLASS KeyValueInformationClass', 'PVOID KeyValueInformation', 'ULONG Length', 'PULONG ResultLength']
 	case 155: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQueryValueKey_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQueryValueKey_return);
+		if (PPP_CHECK_CB(on_NtQueryValueKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
 			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQueryValueKey_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 		}
-		PPP_RUN_CB(on_NtQueryValueKey_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 	}; break;
 	// 156 NTSTATUS NtQueryVirtualMemory ['HANDLE ProcessHandle', 'PVOID BaseAddress', 'MEMORY_INFORMATION_CLASS MemoryInformationClass', 'PVOID MemoryInformation', 'SIZE_T MemoryInformationLength', 'PSIZE_T ReturnLength']
 	case 156: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQueryVirtualMemory_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQueryVirtualMemory_return);
+		if (PPP_CHECK_CB(on_NtQueryVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
 			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQueryVirtualMemory_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 		}
-		PPP_RUN_CB(on_NtQueryVirtualMemory_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 	}; break;
 	// 157 NTSTATUS NtQueryVolumeInformationFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID FsInformation', 'ULONG Length', 'FS_INFORMATION_CLASS FsInformationClass']
 	case 157: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQueryVolumeInformationFile_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQueryVolumeInformationFile_return);
+		if (PPP_CHECK_CB(on_NtQueryVolumeInformationFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQueryVolumeInformationFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtQueryVolumeInformationFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 158 NTSTATUS NtQueueApcThread ['HANDLE ThreadHandle', 'PPS_APC_ROUTINE ApcRoutine', 'PVOID ApcArgument1', 'PVOID ApcArgument2', 'PVOID ApcArgument3']
 	case 158: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtQueueApcThread_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtQueueApcThread_return);
+		if (PPP_CHECK_CB(on_NtQueueApcThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtQueueApcThread_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtQueueApcThread_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 159 NTSTATUS NtRaiseException ['PEXCEPTION_RECORD ExceptionRecord', 'PCONTEXT ContextRecord', 'BOOLEAN FirstChance']
 	case 159: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtRaiseException_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtRaiseException_return);
+		if (PPP_CHECK_CB(on_NtRaiseException_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtRaiseException_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtRaiseException_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 160 NTSTATUS NtRaiseHardError ['NTSTATUS ErrorStatus', 'ULONG NumberOfParameters', 'ULONG UnicodeStringParameterMask', 'PULONG_PTR Parameters', 'ULONG ValidResponseOptions', 'PULONG Response']
 	case 160: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtRaiseHardError_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtRaiseHardError_return);
+		if (PPP_CHECK_CB(on_NtRaiseHardError_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
 			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtRaiseHardError_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 		}
-		PPP_RUN_CB(on_NtRaiseHardError_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 	}; break;
 	// 161 NTSTATUS NtReadFile ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID Buffer', 'ULONG Length', 'PLARGE_INTEGER ByteOffset', 'PULONG Key']
 	case 161: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtReadFile_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtReadFile_return);
+		if (PPP_CHECK_CB(on_NtReadFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
+			uint32_t arg7 = get_32(cpu, 7);
+			uint32_t arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2971,24 +2974,24 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[6], &arg6, sizeof(uint32_t));
 			memcpy(ctx.args[7], &arg7, sizeof(uint32_t));
 			memcpy(ctx.args[8], &arg8, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtReadFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
 		}
-		PPP_RUN_CB(on_NtReadFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
 	}; break;
 	// 162 NTSTATUS NtReadFileScatter ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'PFILE_SEGMENT_ELEMENT SegmentArray', 'ULONG Length', 'PLARGE_INTEGER ByteOffset', 'PULONG Key']
 	case 162: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtReadFileScatter_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtReadFileScatter_return);
+		if (PPP_CHECK_CB(on_NtReadFileScatter_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
+			uint32_t arg7 = get_32(cpu, 7);
+			uint32_t arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -2998,311 +3001,311 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[6], &arg6, sizeof(uint32_t));
 			memcpy(ctx.args[7], &arg7, sizeof(uint32_t));
 			memcpy(ctx.args[8], &arg8, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtReadFileScatter_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
 		}
-		PPP_RUN_CB(on_NtReadFileScatter_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
 	}; break;
 	// 163 NTSTATUS NtReadRequestData ['HANDLE PortHandle', 'PPORT_MESSAGE Message', 'ULONG DataEntryIndex', 'PVOID Buffer', 'SIZE_T BufferSize', 'PSIZE_T NumberOfBytesRead']
 	case 163: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtReadRequestData_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtReadRequestData_return);
+		if (PPP_CHECK_CB(on_NtReadRequestData_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
 			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtReadRequestData_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 		}
-		PPP_RUN_CB(on_NtReadRequestData_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 	}; break;
 	// 164 NTSTATUS NtReadVirtualMemory ['HANDLE ProcessHandle', 'PVOID BaseAddress', 'PVOID Buffer', 'SIZE_T BufferSize', 'PSIZE_T NumberOfBytesRead']
 	case 164: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtReadVirtualMemory_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtReadVirtualMemory_return);
+		if (PPP_CHECK_CB(on_NtReadVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtReadVirtualMemory_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtReadVirtualMemory_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 165 NTSTATUS NtRegisterThreadTerminatePort ['HANDLE PortHandle']
 	case 165: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_return);
+		if (PPP_CHECK_CB(on_NtRegisterThreadTerminatePort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtRegisterThreadTerminatePort_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_NtRegisterThreadTerminatePort_enter, cpu, pc, arg0);
 	}; break;
 	// 166 NTSTATUS NtReleaseMutant ['HANDLE MutantHandle', 'PLONG PreviousCount']
 	case 166: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtReleaseMutant_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtReleaseMutant_return);
+		if (PPP_CHECK_CB(on_NtReleaseMutant_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtReleaseMutant_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtReleaseMutant_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 167 NTSTATUS NtReleaseSemaphore ['HANDLE SemaphoreHandle', 'LONG ReleaseCount', 'PLONG PreviousCount']
 	case 167: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		int32_t arg1 = get_s32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtReleaseSemaphore_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtReleaseSemaphore_return);
+		if (PPP_CHECK_CB(on_NtReleaseSemaphore_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			int32_t arg1 = get_s32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(int32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtReleaseSemaphore_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtReleaseSemaphore_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 168 NTSTATUS NtRemoveIoCompletion ['HANDLE IoCompletionHandle', 'PVOID *KeyContext', 'PVOID *ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'PLARGE_INTEGER Timeout']
 	case 168: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtRemoveIoCompletion_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtRemoveIoCompletion_return);
+		if (PPP_CHECK_CB(on_NtRemoveIoCompletion_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtRemoveIoCompletion_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtRemoveIoCompletion_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 169 NTSTATUS NtReplaceKey ['POBJECT_ATTRIBUTES NewFile', 'HANDLE TargetHandle', 'POBJECT_ATTRIBUTES OldFile']
 	case 169: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtReplaceKey_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtReplaceKey_return);
+		if (PPP_CHECK_CB(on_NtReplaceKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtReplaceKey_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtReplaceKey_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 170 NTSTATUS NtReplyPort ['HANDLE PortHandle', 'PPORT_MESSAGE ReplyMessage']
 	case 170: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtReplyPort_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtReplyPort_return);
+		if (PPP_CHECK_CB(on_NtReplyPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtReplyPort_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtReplyPort_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 171 NTSTATUS NtReplyWaitReceivePort ['HANDLE PortHandle', 'PVOID *PortContext', 'PPORT_MESSAGE ReplyMessage', 'PPORT_MESSAGE ReceiveMessage']
 	case 171: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtReplyWaitReceivePort_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtReplyWaitReceivePort_return);
+		if (PPP_CHECK_CB(on_NtReplyWaitReceivePort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtReplyWaitReceivePort_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_NtReplyWaitReceivePort_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 172 NTSTATUS NtReplyWaitReceivePortEx ['HANDLE PortHandle', 'PVOID *PortContext', 'PPORT_MESSAGE ReplyMessage', 'PPORT_MESSAGE ReceiveMessage', 'PLARGE_INTEGER Timeout']
 	case 172: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_return);
+		if (PPP_CHECK_CB(on_NtReplyWaitReceivePortEx_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtReplyWaitReceivePortEx_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtReplyWaitReceivePortEx_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 173 NTSTATUS NtReplyWaitReplyPort ['HANDLE PortHandle', 'PPORT_MESSAGE ReplyMessage']
 	case 173: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtReplyWaitReplyPort_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtReplyWaitReplyPort_return);
+		if (PPP_CHECK_CB(on_NtReplyWaitReplyPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtReplyWaitReplyPort_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtReplyWaitReplyPort_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 175 NTSTATUS NtRequestPort ['HANDLE PortHandle', 'PPORT_MESSAGE RequestMessage']
 	case 175: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtRequestPort_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtRequestPort_return);
+		if (PPP_CHECK_CB(on_NtRequestPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtRequestPort_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtRequestPort_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 176 NTSTATUS NtRequestWaitReplyPort ['HANDLE PortHandle', 'PPORT_MESSAGE RequestMessage', 'PPORT_MESSAGE ReplyMessage']
 	case 176: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtRequestWaitReplyPort_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtRequestWaitReplyPort_return);
+		if (PPP_CHECK_CB(on_NtRequestWaitReplyPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtRequestWaitReplyPort_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtRequestWaitReplyPort_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 178 NTSTATUS NtResetEvent ['HANDLE EventHandle', 'PLONG PreviousState']
 	case 178: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtResetEvent_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtResetEvent_return);
+		if (PPP_CHECK_CB(on_NtResetEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtResetEvent_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtResetEvent_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 179 NTSTATUS NtResetWriteWatch ['HANDLE ProcessHandle', 'PVOID BaseAddress', 'SIZE_T RegionSize']
 	case 179: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtResetWriteWatch_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtResetWriteWatch_return);
+		if (PPP_CHECK_CB(on_NtResetWriteWatch_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtResetWriteWatch_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtResetWriteWatch_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 180 NTSTATUS NtRestoreKey ['HANDLE KeyHandle', 'HANDLE FileHandle', 'ULONG Flags']
 	case 180: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtRestoreKey_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtRestoreKey_return);
+		if (PPP_CHECK_CB(on_NtRestoreKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtRestoreKey_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtRestoreKey_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 181 NTSTATUS NtResumeThread ['HANDLE ThreadHandle', 'PULONG PreviousSuspendCount']
 	case 181: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtResumeThread_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtResumeThread_return);
+		if (PPP_CHECK_CB(on_NtResumeThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtResumeThread_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtResumeThread_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 182 NTSTATUS NtSaveKey ['HANDLE KeyHandle', 'HANDLE FileHandle']
 	case 182: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSaveKey_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSaveKey_return);
+		if (PPP_CHECK_CB(on_NtSaveKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSaveKey_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtSaveKey_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 183 NTSTATUS NtSaveMergedKeys ['HANDLE HighPrecedenceKeyHandle', 'HANDLE LowPrecedenceKeyHandle', 'HANDLE FileHandle']
 	case 183: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSaveMergedKeys_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSaveMergedKeys_return);
+		if (PPP_CHECK_CB(on_NtSaveMergedKeys_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSaveMergedKeys_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtSaveMergedKeys_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 184 NTSTATUS NtSecureConnectPort ['PHANDLE PortHandle', 'PUNICODE_STRING PortName', 'PSECURITY_QUALITY_OF_SERVICE SecurityQos', 'PPORT_VIEW ClientView', 'PSID RequiredServerSid', 'PREMOTE_PORT_VIEW ServerView', 'PULONG MaxMessageLength', 'PVOID ConnectionInformation', 'PULONG ConnectionInformationLength']
 	case 184: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSecureConnectPort_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSecureConnectPort_return);
+		if (PPP_CHECK_CB(on_NtSecureConnectPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
+			uint32_t arg7 = get_32(cpu, 7);
+			uint32_t arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3312,419 +3315,419 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[6], &arg6, sizeof(uint32_t));
 			memcpy(ctx.args[7], &arg7, sizeof(uint32_t));
 			memcpy(ctx.args[8], &arg8, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSecureConnectPort_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
 		}
-		PPP_RUN_CB(on_NtSecureConnectPort_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
 	}; break;
 	// 185 NTSTATUS NtSetIoCompletion ['HANDLE IoCompletionHandle', 'PVOID KeyContext', 'PVOID ApcContext', 'NTSTATUS IoStatus', 'ULONG_PTR IoStatusInformation']
 	case 185: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSetIoCompletion_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSetIoCompletion_return);
+		if (PPP_CHECK_CB(on_NtSetIoCompletion_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSetIoCompletion_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtSetIoCompletion_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 186 NTSTATUS NtSetContextThread ['HANDLE ThreadHandle', 'PCONTEXT ThreadContext']
 	case 186: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSetContextThread_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSetContextThread_return);
+		if (PPP_CHECK_CB(on_NtSetContextThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSetContextThread_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtSetContextThread_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 187 NTSTATUS NtSetDefaultHardErrorPort ['HANDLE DefaultHardErrorPort']
 	case 187: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_return);
+		if (PPP_CHECK_CB(on_NtSetDefaultHardErrorPort_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSetDefaultHardErrorPort_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_NtSetDefaultHardErrorPort_enter, cpu, pc, arg0);
 	}; break;
 	// 188 NTSTATUS NtSetDefaultLocale ['BOOLEAN UserProfile', 'LCID DefaultLocaleId']
 	case 188: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSetDefaultLocale_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSetDefaultLocale_return);
+		if (PPP_CHECK_CB(on_NtSetDefaultLocale_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSetDefaultLocale_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtSetDefaultLocale_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 189 NTSTATUS NtSetDefaultUILanguage ['LANGID DefaultUILanguageId']
 	case 189: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSetDefaultUILanguage_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSetDefaultUILanguage_return);
+		if (PPP_CHECK_CB(on_NtSetDefaultUILanguage_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSetDefaultUILanguage_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_NtSetDefaultUILanguage_enter, cpu, pc, arg0);
 	}; break;
 	// 190 NTSTATUS NtSetEaFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID Buffer', 'ULONG Length']
 	case 190: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSetEaFile_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSetEaFile_return);
+		if (PPP_CHECK_CB(on_NtSetEaFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSetEaFile_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_NtSetEaFile_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 191 NTSTATUS NtSetEvent ['HANDLE EventHandle', 'PLONG PreviousState']
 	case 191: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSetEvent_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSetEvent_return);
+		if (PPP_CHECK_CB(on_NtSetEvent_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSetEvent_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtSetEvent_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 192 NTSTATUS NtSetHighEventPair ['HANDLE EventPairHandle']
 	case 192: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSetHighEventPair_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSetHighEventPair_return);
+		if (PPP_CHECK_CB(on_NtSetHighEventPair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSetHighEventPair_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_NtSetHighEventPair_enter, cpu, pc, arg0);
 	}; break;
 	// 193 NTSTATUS NtSetHighWaitLowEventPair ['HANDLE EventPairHandle']
 	case 193: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_return);
+		if (PPP_CHECK_CB(on_NtSetHighWaitLowEventPair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSetHighWaitLowEventPair_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_NtSetHighWaitLowEventPair_enter, cpu, pc, arg0);
 	}; break;
 	// 194 NTSTATUS NtSetInformationFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID FileInformation', 'ULONG Length', 'FILE_INFORMATION_CLASS FileInformationClass']
 	case 194: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSetInformationFile_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSetInformationFile_return);
+		if (PPP_CHECK_CB(on_NtSetInformationFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSetInformationFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtSetInformationFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 195 NTSTATUS NtSetInformationJobObject ['HANDLE JobHandle', 'JOBOBJECTINFOCLASS JobObjectInformationClass', 'PVOID JobObjectInformation', 'ULONG JobObjectInformationLength']
 	case 195: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSetInformationJobObject_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSetInformationJobObject_return);
+		if (PPP_CHECK_CB(on_NtSetInformationJobObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSetInformationJobObject_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_NtSetInformationJobObject_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 196 NTSTATUS NtSetInformationKey ['HANDLE KeyHandle', 'KEY_SET_INFORMATION_CLASS KeySetInformationClass', 'PVOID KeySetInformation', 'ULONG KeySetInformationLength']
 	case 196: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSetInformationKey_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSetInformationKey_return);
+		if (PPP_CHECK_CB(on_NtSetInformationKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSetInformationKey_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_NtSetInformationKey_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 197 NTSTATUS NtSetInformationObject ['HANDLE Handle', 'OBJECT_INFORMATION_CLASS ObjectInformationClass', 'PVOID ObjectInformation', 'ULONG ObjectInformationLength']
 	case 197: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSetInformationObject_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSetInformationObject_return);
+		if (PPP_CHECK_CB(on_NtSetInformationObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSetInformationObject_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_NtSetInformationObject_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 198 NTSTATUS NtSetInformationProcess ['HANDLE ProcessHandle', 'PROCESSINFOCLASS ProcessInformationClass', 'PVOID ProcessInformation', 'ULONG ProcessInformationLength']
 	case 198: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSetInformationProcess_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSetInformationProcess_return);
+		if (PPP_CHECK_CB(on_NtSetInformationProcess_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSetInformationProcess_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_NtSetInformationProcess_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 199 NTSTATUS NtSetInformationThread ['HANDLE ThreadHandle', 'THREADINFOCLASS ThreadInformationClass', 'PVOID ThreadInformation', 'ULONG ThreadInformationLength']
 	case 199: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSetInformationThread_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSetInformationThread_return);
+		if (PPP_CHECK_CB(on_NtSetInformationThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSetInformationThread_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_NtSetInformationThread_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 200 NTSTATUS NtSetInformationToken ['HANDLE TokenHandle', 'TOKEN_INFORMATION_CLASS TokenInformationClass', 'PVOID TokenInformation', 'ULONG TokenInformationLength']
 	case 200: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSetInformationToken_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSetInformationToken_return);
+		if (PPP_CHECK_CB(on_NtSetInformationToken_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSetInformationToken_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_NtSetInformationToken_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 201 NTSTATUS NtSetIntervalProfile ['ULONG Interval', 'KPROFILE_SOURCE Source']
 	case 201: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSetIntervalProfile_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSetIntervalProfile_return);
+		if (PPP_CHECK_CB(on_NtSetIntervalProfile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSetIntervalProfile_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtSetIntervalProfile_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 202 NTSTATUS NtSetLdtEntries ['ULONG Selector0', 'ULONG Entry0Low', 'ULONG Entry0Hi', 'ULONG Selector1', 'ULONG Entry1Low', 'ULONG Entry1Hi']
 	case 202: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSetLdtEntries_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSetLdtEntries_return);
+		if (PPP_CHECK_CB(on_NtSetLdtEntries_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
 			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSetLdtEntries_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 		}
-		PPP_RUN_CB(on_NtSetLdtEntries_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 	}; break;
 	// 203 NTSTATUS NtSetLowEventPair ['HANDLE EventPairHandle']
 	case 203: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSetLowEventPair_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSetLowEventPair_return);
+		if (PPP_CHECK_CB(on_NtSetLowEventPair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSetLowEventPair_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_NtSetLowEventPair_enter, cpu, pc, arg0);
 	}; break;
 	// 204 NTSTATUS NtSetLowWaitHighEventPair ['HANDLE EventPairHandle']
 	case 204: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_return);
+		if (PPP_CHECK_CB(on_NtSetLowWaitHighEventPair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSetLowWaitHighEventPair_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_NtSetLowWaitHighEventPair_enter, cpu, pc, arg0);
 	}; break;
 	// 205 NTSTATUS NtSetQuotaInformationFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID Buffer', 'ULONG Length']
 	case 205: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSetQuotaInformationFile_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSetQuotaInformationFile_return);
+		if (PPP_CHECK_CB(on_NtSetQuotaInformationFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSetQuotaInformationFile_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_NtSetQuotaInformationFile_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 206 NTSTATUS NtSetSecurityObject ['HANDLE Handle', 'SECURITY_INFORMATION SecurityInformation', 'PSECURITY_DESCRIPTOR SecurityDescriptor']
 	case 206: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSetSecurityObject_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSetSecurityObject_return);
+		if (PPP_CHECK_CB(on_NtSetSecurityObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSetSecurityObject_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtSetSecurityObject_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 207 NTSTATUS NtSetSystemEnvironmentValue ['PUNICODE_STRING VariableName', 'PUNICODE_STRING VariableValue']
 	case 207: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_return);
+		if (PPP_CHECK_CB(on_NtSetSystemEnvironmentValue_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSetSystemEnvironmentValue_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtSetSystemEnvironmentValue_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 208 NTSTATUS NtSetSystemInformation ['SYSTEM_INFORMATION_CLASS SystemInformationClass', 'PVOID SystemInformation', 'ULONG SystemInformationLength']
 	case 208: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSetSystemInformation_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSetSystemInformation_return);
+		if (PPP_CHECK_CB(on_NtSetSystemInformation_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSetSystemInformation_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtSetSystemInformation_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 209 NTSTATUS NtSetSystemPowerState ['POWER_ACTION SystemAction', 'SYSTEM_POWER_STATE MinSystemState', 'ULONG Flags']
 	case 209: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSetSystemPowerState_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSetSystemPowerState_return);
+		if (PPP_CHECK_CB(on_NtSetSystemPowerState_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSetSystemPowerState_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtSetSystemPowerState_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 210 NTSTATUS NtSetSystemTime ['PLARGE_INTEGER SystemTime', 'PLARGE_INTEGER PreviousTime']
 	case 210: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSetSystemTime_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSetSystemTime_return);
+		if (PPP_CHECK_CB(on_NtSetSystemTime_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSetSystemTime_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtSetSystemTime_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 211 NTSTATUS NtSetThreadExecutionState ['EXECUTION_STATE esFlags', 'PEXECUTION_STATE PreviousFlags']
 	case 211: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSetThreadExecutionState_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSetThreadExecutionState_return);
+		if (PPP_CHECK_CB(on_NtSetThreadExecutionState_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSetThreadExecutionState_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtSetThreadExecutionState_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 212 NTSTATUS NtSetTimer ['HANDLE TimerHandle', 'PLARGE_INTEGER DueTime', 'PTIMER_APC_ROUTINE TimerApcRoutine', 'PVOID TimerContext', 'BOOLEAN WakeTimer', 'LONG Period', 'PBOOLEAN PreviousState']
 	case 212: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		int32_t arg5 = get_s32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSetTimer_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSetTimer_return);
+		if (PPP_CHECK_CB(on_NtSetTimer_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			int32_t arg5 = get_s32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -3732,358 +3735,359 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
 			memcpy(ctx.args[5], &arg5, sizeof(int32_t));
 			memcpy(ctx.args[6], &arg6, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSetTimer_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
 		}
-		PPP_RUN_CB(on_NtSetTimer_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6);
 	}; break;
 	// 213 NTSTATUS NtSetTimerResolution ['ULONG DesiredTime', 'BOOLEAN SetResolution', 'PULONG ActualTime']
 	case 213: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSetTimerResolution_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSetTimerResolution_return);
+		if (PPP_CHECK_CB(on_NtSetTimerResolution_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSetTimerResolution_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtSetTimerResolution_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 214 NTSTATUS NtSetUuidSeed ['PCHAR Seed']
 	case 214: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSetUuidSeed_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSetUuidSeed_return);
+		if (PPP_CHECK_CB(on_NtSetUuidSeed_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSetUuidSeed_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_NtSetUuidSeed_enter, cpu, pc, arg0);
 	}; break;
 	// 215 NTSTATUS NtSetValueKey ['HANDLE KeyHandle', 'PUNICODE_STRING ValueName', 'ULONG TitleIndex', 'ULONG Type', 'PVOID Data', 'ULONG DataSize']
 	case 215: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSetValueKey_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSetValueKey_return);
+		if (PPP_CHECK_CB(on_NtSetValueKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
 			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSetValueKey_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 		}
-		PPP_RUN_CB(on_NtSetValueKey_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 	}; break;
 	// 216 NTSTATUS NtSetVolumeInformationFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID FsInformation', 'ULONG Length', 'FS_INFORMATION_CLASS FsInformationClass']
 	case 216: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSetVolumeInformationFile_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSetVolumeInformationFile_return);
+		if (PPP_CHECK_CB(on_NtSetVolumeInformationFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSetVolumeInformationFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtSetVolumeInformationFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 217 NTSTATUS NtShutdownSystem ['SHUTDOWN_ACTION Action']
 	case 217: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtShutdownSystem_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtShutdownSystem_return);
+		if (PPP_CHECK_CB(on_NtShutdownSystem_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtShutdownSystem_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_NtShutdownSystem_enter, cpu, pc, arg0);
 	}; break;
 	// 218 NTSTATUS NtSignalAndWaitForSingleObject ['HANDLE SignalHandle', 'HANDLE WaitHandle', 'BOOLEAN Alertable', 'PLARGE_INTEGER Timeout']
 	case 218: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_return);
+		if (PPP_CHECK_CB(on_NtSignalAndWaitForSingleObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSignalAndWaitForSingleObject_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_NtSignalAndWaitForSingleObject_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 219 NTSTATUS NtStartProfile ['HANDLE ProfileHandle']
 	case 219: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtStartProfile_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtStartProfile_return);
+		if (PPP_CHECK_CB(on_NtStartProfile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtStartProfile_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_NtStartProfile_enter, cpu, pc, arg0);
 	}; break;
 	// 220 NTSTATUS NtStopProfile ['HANDLE ProfileHandle']
 	case 220: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtStopProfile_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtStopProfile_return);
+		if (PPP_CHECK_CB(on_NtStopProfile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtStopProfile_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_NtStopProfile_enter, cpu, pc, arg0);
 	}; break;
 	// 221 NTSTATUS NtSuspendThread ['HANDLE ThreadHandle', 'PULONG PreviousSuspendCount']
 	case 221: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSuspendThread_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSuspendThread_return);
+		if (PPP_CHECK_CB(on_NtSuspendThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSuspendThread_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtSuspendThread_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 222 NTSTATUS NtSystemDebugControl ['SYSDBG_COMMAND Command', 'PVOID InputBuffer', 'ULONG InputBufferLength', 'PVOID OutputBuffer', 'ULONG OutputBufferLength', 'PULONG ReturnLength']
 	case 222: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtSystemDebugControl_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtSystemDebugControl_return);
+		if (PPP_CHECK_CB(on_NtSystemDebugControl_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
 			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtSystemDebugControl_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 		}
-		PPP_RUN_CB(on_NtSystemDebugControl_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 	}; break;
 	// 223 NTSTATUS NtTerminateJobObject ['HANDLE JobHandle', 'NTSTATUS ExitStatus']
 	case 223: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtTerminateJobObject_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtTerminateJobObject_return);
+		if (PPP_CHECK_CB(on_NtTerminateJobObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtTerminateJobObject_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtTerminateJobObject_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 224 NTSTATUS NtTerminateProcess ['HANDLE ProcessHandle', 'NTSTATUS ExitStatus']
 	case 224: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtTerminateProcess_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtTerminateProcess_return);
+		if (PPP_CHECK_CB(on_NtTerminateProcess_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtTerminateProcess_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtTerminateProcess_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 225 NTSTATUS NtTerminateThread ['HANDLE ThreadHandle', 'NTSTATUS ExitStatus']
 	case 225: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtTerminateThread_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtTerminateThread_return);
+		if (PPP_CHECK_CB(on_NtTerminateThread_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtTerminateThread_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtTerminateThread_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 226 NTSTATUS NtTestAlert ['']
 	case 226: {
 		panda_noreturn = false;
+		return_cb = PPP_CHECK_CB(on_NtTestAlert_return);
 		PPP_RUN_CB(on_NtTestAlert_enter, cpu, pc);
 	}; break;
 	// 227 NTSTATUS NtUnloadDriver ['PUNICODE_STRING DriverServiceName']
 	case 227: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtUnloadDriver_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtUnloadDriver_return);
+		if (PPP_CHECK_CB(on_NtUnloadDriver_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtUnloadDriver_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_NtUnloadDriver_enter, cpu, pc, arg0);
 	}; break;
 	// 228 NTSTATUS NtUnloadKey ['POBJECT_ATTRIBUTES TargetKey']
 	case 228: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtUnloadKey_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtUnloadKey_return);
+		if (PPP_CHECK_CB(on_NtUnloadKey_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtUnloadKey_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_NtUnloadKey_enter, cpu, pc, arg0);
 	}; break;
 	// 229 NTSTATUS NtUnlockFile ['HANDLE FileHandle', 'PIO_STATUS_BLOCK IoStatusBlock', 'PLARGE_INTEGER ByteOffset', 'PLARGE_INTEGER Length', 'ULONG Key']
 	case 229: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtUnlockFile_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtUnlockFile_return);
+		if (PPP_CHECK_CB(on_NtUnlockFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtUnlockFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtUnlockFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 230 NTSTATUS NtUnlockVirtualMemory ['HANDLE ProcessHandle', 'PVOID *BaseAddress', 'PSIZE_T RegionSize', 'ULONG MapType']
 	case 230: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtUnlockVirtualMemory_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtUnlockVirtualMemory_return);
+		if (PPP_CHECK_CB(on_NtUnlockVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtUnlockVirtualMemory_enter, cpu, pc, arg0, arg1, arg2, arg3);
 		}
-		PPP_RUN_CB(on_NtUnlockVirtualMemory_enter, cpu, pc, arg0, arg1, arg2, arg3);
 	}; break;
 	// 231 NTSTATUS NtUnmapViewOfSection ['HANDLE ProcessHandle', 'PVOID BaseAddress']
 	case 231: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtUnmapViewOfSection_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtUnmapViewOfSection_return);
+		if (PPP_CHECK_CB(on_NtUnmapViewOfSection_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtUnmapViewOfSection_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtUnmapViewOfSection_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 232 NTSTATUS NtVdmControl ['VDMSERVICECLASS Service', 'PVOID ServiceData']
 	case 232: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtVdmControl_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtVdmControl_return);
+		if (PPP_CHECK_CB(on_NtVdmControl_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtVdmControl_enter, cpu, pc, arg0, arg1);
 		}
-		PPP_RUN_CB(on_NtVdmControl_enter, cpu, pc, arg0, arg1);
 	}; break;
 	// 233 NTSTATUS NtWaitForMultipleObjects ['ULONG Count', 'HANDLE Handles[]', 'WAIT_TYPE WaitType', 'BOOLEAN Alertable', 'PLARGE_INTEGER Timeout']
 	case 233: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtWaitForMultipleObjects_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtWaitForMultipleObjects_return);
+		if (PPP_CHECK_CB(on_NtWaitForMultipleObjects_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtWaitForMultipleObjects_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtWaitForMultipleObjects_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 234 NTSTATUS NtWaitForSingleObject ['HANDLE Handle', 'BOOLEAN Alertable', 'PLARGE_INTEGER Timeout']
 	case 234: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtWaitForSingleObject_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtWaitForSingleObject_return);
+		if (PPP_CHECK_CB(on_NtWaitForSingleObject_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtWaitForSingleObject_enter, cpu, pc, arg0, arg1, arg2);
 		}
-		PPP_RUN_CB(on_NtWaitForSingleObject_enter, cpu, pc, arg0, arg1, arg2);
 	}; break;
 	// 235 NTSTATUS NtWaitHighEventPair ['HANDLE EventPairHandle']
 	case 235: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtWaitHighEventPair_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtWaitHighEventPair_return);
+		if (PPP_CHECK_CB(on_NtWaitHighEventPair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtWaitHighEventPair_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_NtWaitHighEventPair_enter, cpu, pc, arg0);
 	}; break;
 	// 236 NTSTATUS NtWaitLowEventPair ['HANDLE EventPairHandle']
 	case 236: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtWaitLowEventPair_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtWaitLowEventPair_return);
+		if (PPP_CHECK_CB(on_NtWaitLowEventPair_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtWaitLowEventPair_enter, cpu, pc, arg0);
 		}
-		PPP_RUN_CB(on_NtWaitLowEventPair_enter, cpu, pc, arg0);
 	}; break;
 	// 237 NTSTATUS NtWriteFile ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'PVOID Buffer', 'ULONG Length', 'PLARGE_INTEGER ByteOffset', 'PULONG Key']
 	case 237: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtWriteFile_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtWriteFile_return);
+		if (PPP_CHECK_CB(on_NtWriteFile_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
+			uint32_t arg7 = get_32(cpu, 7);
+			uint32_t arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4093,24 +4097,24 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[6], &arg6, sizeof(uint32_t));
 			memcpy(ctx.args[7], &arg7, sizeof(uint32_t));
 			memcpy(ctx.args[8], &arg8, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtWriteFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
 		}
-		PPP_RUN_CB(on_NtWriteFile_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
 	}; break;
 	// 238 NTSTATUS NtWriteFileGather ['HANDLE FileHandle', 'HANDLE Event', 'PIO_APC_ROUTINE ApcRoutine', 'PVOID ApcContext', 'PIO_STATUS_BLOCK IoStatusBlock', 'PFILE_SEGMENT_ELEMENT SegmentArray', 'ULONG Length', 'PLARGE_INTEGER ByteOffset', 'PULONG Key']
 	case 238: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		uint32_t arg6 = get_32(cpu, 6);
-		uint32_t arg7 = get_32(cpu, 7);
-		uint32_t arg8 = get_32(cpu, 8);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtWriteFileGather_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtWriteFileGather_return);
+		if (PPP_CHECK_CB(on_NtWriteFileGather_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
+			uint32_t arg6 = get_32(cpu, 6);
+			uint32_t arg7 = get_32(cpu, 7);
+			uint32_t arg8 = get_32(cpu, 8);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
@@ -4120,63 +4124,71 @@ void syscall_enter_switch_windows_2000_x86(CPUState *cpu, target_ptr_t pc) {
 			memcpy(ctx.args[6], &arg6, sizeof(uint32_t));
 			memcpy(ctx.args[7], &arg7, sizeof(uint32_t));
 			memcpy(ctx.args[8], &arg8, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtWriteFileGather_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
 		}
-		PPP_RUN_CB(on_NtWriteFileGather_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
 	}; break;
 	// 239 NTSTATUS NtWriteRequestData ['HANDLE PortHandle', 'PPORT_MESSAGE Message', 'ULONG DataEntryIndex', 'PVOID Buffer', 'SIZE_T BufferSize', 'PSIZE_T NumberOfBytesWritten']
 	case 239: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		uint32_t arg5 = get_32(cpu, 5);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtWriteRequestData_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtWriteRequestData_return);
+		if (PPP_CHECK_CB(on_NtWriteRequestData_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
+			uint32_t arg5 = get_32(cpu, 5);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
 			memcpy(ctx.args[5], &arg5, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtWriteRequestData_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 		}
-		PPP_RUN_CB(on_NtWriteRequestData_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4, arg5);
 	}; break;
 	// 240 NTSTATUS NtWriteVirtualMemory ['HANDLE ProcessHandle', 'PVOID BaseAddress', 'PVOID Buffer', 'SIZE_T BufferSize', 'PSIZE_T NumberOfBytesWritten']
 	case 240: {
 		panda_noreturn = false;
-		uint32_t arg0 = get_32(cpu, 0);
-		uint32_t arg1 = get_32(cpu, 1);
-		uint32_t arg2 = get_32(cpu, 2);
-		uint32_t arg3 = get_32(cpu, 3);
-		uint32_t arg4 = get_32(cpu, 4);
-		if (PPP_CHECK_CB(on_all_sys_enter2) ||
-			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) ||
-					PPP_CHECK_CB(on_NtWriteVirtualMemory_return)))) {
+		return_cb = PPP_CHECK_CB(on_NtWriteVirtualMemory_return);
+		if (PPP_CHECK_CB(on_NtWriteVirtualMemory_enter) || PPP_CHECK_CB(on_all_sys_enter2) ||
+			(!panda_noreturn && (PPP_CHECK_CB(on_all_sys_return2) || return_cb))) {
+			uint32_t arg0 = get_32(cpu, 0);
+			uint32_t arg1 = get_32(cpu, 1);
+			uint32_t arg2 = get_32(cpu, 2);
+			uint32_t arg3 = get_32(cpu, 3);
+			uint32_t arg4 = get_32(cpu, 4);
 			memcpy(ctx.args[0], &arg0, sizeof(uint32_t));
 			memcpy(ctx.args[1], &arg1, sizeof(uint32_t));
 			memcpy(ctx.args[2], &arg2, sizeof(uint32_t));
 			memcpy(ctx.args[3], &arg3, sizeof(uint32_t));
 			memcpy(ctx.args[4], &arg4, sizeof(uint32_t));
+			PPP_RUN_CB(on_NtWriteVirtualMemory_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 		}
-		PPP_RUN_CB(on_NtWriteVirtualMemory_enter, cpu, pc, arg0, arg1, arg2, arg3, arg4);
 	}; break;
 	// 247 NTSTATUS NtYieldExecution ['']
 	case 247: {
 		panda_noreturn = false;
+		return_cb = PPP_CHECK_CB(on_NtYieldExecution_return);
 		PPP_RUN_CB(on_NtYieldExecution_enter, cpu, pc);
 	}; break;
 	default:
 		panda_noreturn = false;
+		return_cb = PPP_CHECK_CB(on_unknown_sys_return);
 		PPP_RUN_CB(on_unknown_sys_enter, cpu, pc, ctx.no);
 	} // switch (ctx.no)
 
+	// Only track the return if a callback is going to be told about it.
+	panda_noreturn = panda_noreturn || !(return_cb ||
+			PPP_CHECK_CB(on_all_sys_return) || PPP_CHECK_CB(on_all_sys_return2));
+	if (!panda_noreturn || PPP_CHECK_CB(on_all_sys_enter2)) {
+		ctx.retaddr = calc_retaddr(cpu, pc);
+	}
 	PPP_RUN_CB(on_all_sys_enter, cpu, pc, ctx.no);
 	PPP_RUN_CB(on_all_sys_enter2, cpu, pc, call, &ctx);
 	if (!panda_noreturn) {
-		running_syscalls[std::make_pair(ctx.retaddr, ctx.asid)] = ctx;
+		running_syscalls_add(&ctx);
 	}
 #endif
 }
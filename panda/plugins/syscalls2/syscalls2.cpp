@@ -38,6 +38,8 @@ PANDAENDCOMMENT */
 
 bool translate_callback(CPUState *cpu, target_ulong pc);
 int exec_callback(CPUState *cpu, target_ulong pc);
+int before_block_translate(CPUState *cpu, target_ulong pc);
+int after_block_translate(CPUState *cpu, TranslationBlock *tb);
 
 extern "C" {
 bool init_plugin(void *);
@@ -250,9 +252,9 @@ target_ulong mask_retaddr_to_pc(target_ulong retaddr){
 target_ulong calc_retaddr_windows_x86(CPUState* cpu, target_ulong pc) {
 #if defined(TARGET_I386)
     CPUArchState *env = (CPUArchState*)cpu->env_ptr;
-    target_ulong retaddr = 0;
+    uint32_t retaddr = 0;
     assert(syscalls_profile->windows_return_addr_register >= 0);
-    panda_virtual_memory_rw(cpu, env->regs[syscalls_profile->windows_return_addr_register], (uint8_t *) &retaddr, 4, false);
+    panda_virtual_read_u32(cpu, env->regs[syscalls_profile->windows_return_addr_register], &retaddr);
     return retaddr;
 #else
     // shouldn't happen
@@ -346,8 +348,7 @@ static uint32_t get_win_syscall_arg(CPUState* cpu, int nr) {
     CPUArchState *env = (CPUArchState*)cpu->env_ptr;
     uint32_t arg = 0;
     assert(syscalls_profile->windows_arg_offset >= 0);
-    panda_virtual_memory_rw(cpu, env->regs[R_EDX] + syscalls_profile->windows_arg_offset + (4*nr),
-                            (uint8_t *) &arg, 4, false);
+    panda_virtual_read_u32(cpu, env->regs[R_EDX] + syscalls_profile->windows_arg_offset + (4*nr), &arg);
     return arg;
 #endif
     return 0;
@@ -396,8 +397,7 @@ static uint32_t get_win_syscall_return_arg(CPUState* cpu, int nr) {
     // At sysenter on Windows7, args start at env->regs[R_EDX]+8
     CPUArchState *env = (CPUArchState*)cpu->env_ptr;
     uint32_t arg = 0;
-    panda_virtual_memory_rw(cpu, env->regs[R_ESP] + 4 + (4*nr),
-                            (uint8_t *) &arg, 4, false);
+    panda_virtual_read_u32(cpu, env->regs[R_ESP] + 4 + (4*nr), &arg);
     return arg;
 #else
     return 0;
@@ -477,6 +477,31 @@ extern const syscall_meta_t *syscall_meta;
  */
 context_map_t running_syscalls;
 
+/**
+ * @brief Number of entries of running_syscalls per hash of their return
+ * address. Lets tb_check_syscall_return() dismiss almost every block with
+ * a single load, without looking up the asid or the map. A slot counts
+ * every running syscall that hashes to it, so it must not be able to wrap:
+ * one that wrapped to 0 would hide the returns of those syscalls.
+ */
+#define RETADDR_FILTER_BITS 12
+static uint32_t retaddr_filter[1 << RETADDR_FILTER_BITS];
+
+static inline uint32_t &retaddr_filter_slot(target_ptr_t retaddr) {
+    return retaddr_filter[(retaddr ^ (retaddr >> RETADDR_FILTER_BITS)) &
+                          ((1 << RETADDR_FILTER_BITS) - 1)];
+}
+
+void running_syscalls_add(const syscall_ctx_t *ctx) {
+    auto r = running_syscalls.insert(std::make_pair(
+                std::make_pair(ctx->retaddr, ctx->asid), *ctx));
+    if (r.second) {
+        retaddr_filter_slot(ctx->retaddr)++;
+    } else {
+        r.first->second = *ctx;
+    }
+}
+
 #if defined(SYSCALL_RETURN_DEBUG)
 /**
  * @brief Returns a string representation of a context_map_t container.
@@ -510,6 +535,9 @@ static inline std::string context_map_t_dump(context_map_t &cm) {
  * matches the return address of an executing system call.
  */
 static int tb_check_syscall_return(CPUState *cpu, TranslationBlock *tb) {
+    uint32_t &slot = retaddr_filter_slot(tb->pc);
+    if (likely(slot == 0)) return 0;
+
     auto k = std::make_pair(tb->pc, panda_current_asid(cpu));
     auto ctxi = running_syscalls.find(k);
     int UNUSED(no) = -1;
@@ -518,6 +546,7 @@ static int tb_check_syscall_return(CPUState *cpu, TranslationBlock *tb) {
         no = ctx->no;
         syscalls_profile->return_switch(cpu, tb->pc, ctx);
         running_syscalls.erase(ctxi);
+        slot--;
     }
 #if defined(SYSCALL_RETURN_DEBUG)
     if (no >= 0) {
@@ -537,13 +566,59 @@ static std::map<target_ulong,target_ulong> syscallCounter;
 static uint32_t impossibleToReadPCs = 0;
 #endif
 
+/**
+ * @brief Guest code of the block being translated. It is read once, up to
+ * the end of its page, when the first instruction of the block is checked,
+ * so checking each further instruction doesn't go back to guest memory.
+ */
+#define CODE_WINDOW_SIZE 256
+static struct {
+    bool active;    // between before_ and after_block_translate
+    target_ulong start;
+    uint32_t len;
+    uint8_t buf[CODE_WINDOW_SIZE];
+} code_window;
+
+int before_block_translate(CPUState *cpu, target_ulong pc) {
+    code_window.active = true;
+    code_window.start = pc;
+    code_window.len = 0;
+    return 0;
+}
+
+int after_block_translate(CPUState *cpu, TranslationBlock *tb) {
+    code_window.active = false;
+    return 0;
+}
+
+// Reads len bytes of code at pc, from the code window when translating.
+static inline int read_code(CPUState *cpu, target_ulong pc, uint8_t *buf, int len,
+        bool translating) {
+    if (translating && code_window.active) {
+        if (code_window.len == 0 && pc == code_window.start) {
+            target_ulong page_end = (pc & TARGET_PAGE_MASK) + TARGET_PAGE_SIZE;
+            uint32_t n = MIN((target_ulong)CODE_WINDOW_SIZE, page_end - pc);
+            if (panda_virtual_memory_rw(cpu, pc, code_window.buf, n, 0) == 0) {
+                code_window.len = n;
+            }
+        }
+        if (pc >= code_window.start &&
+                pc - code_window.start + len <= code_window.len) {
+            memcpy(buf, code_window.buf + (pc - code_window.start), len);
+            return 0;
+        }
+    }
+    // past the window, or straddling a page boundary
+    return panda_virtual_memory_rw(cpu, pc, buf, len, 0);
+}
+
 // Check if the instruction is sysenter (0F 34),
 // syscall (0F 05) or int 0x80 (CD 80)
-int isCurrentInstructionASyscall(CPUState *cpu, target_ulong pc) {
+static int check_syscall_insn(CPUState *cpu, target_ulong pc, bool translating) {
 #if defined(TARGET_I386)
     unsigned char buf[2] = {};
 
-    int res = panda_virtual_memory_rw(cpu, pc, buf, 2, 0);
+    int res = read_code(cpu, pc, buf, 2, translating);
     if(res <0){
         return -1;
     }
@@ -569,7 +644,7 @@ int isCurrentInstructionASyscall(CPUState *cpu, target_ulong pc) {
     // Check for ARM mode syscall
     CPUArchState *env = (CPUArchState*)cpu->env_ptr;
     if(env->thumb == 0) {
-        panda_virtual_memory_rw(cpu, pc, buf, 4, 0);
+        read_code(cpu, pc, buf, 4, translating);
         // EABI
         if ( ((buf[3] & 0x0F) ==  0x0F)  && (buf[2] == 0) && (buf[1] == 0) && (buf[0] == 0) ) {
             return true;
@@ -581,7 +656,7 @@ int isCurrentInstructionASyscall(CPUState *cpu, target_ulong pc) {
 #endif
     }
     else {
-        panda_virtual_memory_rw(cpu, pc, buf, 2, 0);
+        read_code(cpu, pc, buf, 2, translating);
         // check for Thumb mode syscall
         if (buf[1] == 0xDF && buf[0] == 0){
             return true;
@@ -593,6 +668,10 @@ int isCurrentInstructionASyscall(CPUState *cpu, target_ulong pc) {
 #endif
 }
 
+int isCurrentInstructionASyscall(CPUState *cpu, target_ulong pc) {
+    return check_syscall_insn(cpu, pc, false);
+}
+
 // This will only be called for instructions where the
 // translate_callback returned true
 int exec_callback(CPUState *cpu, target_ulong pc) {
@@ -630,7 +709,7 @@ int exec_callback(CPUState *cpu, target_ulong pc) {
 }
 
 bool translate_callback(CPUState* cpu, target_ulong pc){
-    return isCurrentInstructionASyscall(cpu, pc) == 1;
+    return check_syscall_insn(cpu, pc, true) == 1;
 }
 
 
@@ -690,6 +769,10 @@ bool init_plugin(void *self) {
     panda_arg_list *plugin_args = panda_get_args(PLUGIN_NAME);
 
     panda_cb pcb;
+    pcb.before_block_translate = before_block_translate;
+    panda_register_callback(self, PANDA_CB_BEFORE_BLOCK_TRANSLATE, pcb);
+    pcb.after_block_translate = after_block_translate;
+    panda_register_callback(self, PANDA_CB_AFTER_BLOCK_TRANSLATE, pcb);
     pcb.insn_translate = translate_callback;
     panda_register_callback(self, PANDA_CB_INSN_TRANSLATE, pcb);
     pcb.insn_exec = exec_callback;
@@ -1,10 +1,22 @@
 #pragma once
-#include <map>
+#include <unordered_map>
 typedef struct CPUState CPUState;
 typedef struct syscall_ctx syscall_ctx_t;
-typedef std::map<std::pair<target_ptr_t, target_ptr_t>, syscall_ctx_t> context_map_t;
+
+// (return address, asid) of an unfinished system call
+typedef std::pair<target_ptr_t, target_ptr_t> context_key_t;
+struct context_key_hash {
+    size_t operator()(const context_key_t &k) const {
+        return std::hash<target_ptr_t>()(k.first) * 31 + std::hash<target_ptr_t>()(k.second);
+    }
+};
+typedef std::unordered_map<context_key_t, syscall_ctx_t, context_key_hash> context_map_t;
 extern context_map_t running_syscalls;
 
+// Starts tracking an unfinished system call, so that its return callbacks
+// run when the guest gets back to ctx->retaddr.
+void running_syscalls_add(const syscall_ctx_t *ctx);
+
 // grep -hE '^.*syscall_(enter|return)_switch_[^(]*\(' *.cpp | sed 's/ {$/;/' >> syscalls2.h
 void syscall_enter_switch_linux_arm(CPUState *cpu, target_ptr_t pc);
 void syscall_enter_switch_linux_x86(CPUState *cpu, target_ptr_t pc);
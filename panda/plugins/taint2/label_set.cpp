@@ -1,10 +1,8 @@
-extern "C" {
-#include <sys/mman.h>
-}
-
 #include <cassert>
+#include <cstdlib>
+#include <cstring>
 
-#include <map>
+#include <algorithm>
 #include <vector>
 #include <set>
 #include <unordered_set>
@@ -13,87 +11,189 @@ extern "C" {
 
 #include "label_set.h"
 
-template<typename T>
-class ArenaAlloc {
-private:
-    uint8_t *next = NULL;
-    std::vector<std::pair<uint8_t *, size_t>> blocks;
-    size_t next_block_size = 1 << 15;
-
-    void alloc_block() {
-        //printf("taint2: allocating block of size %lu\n", next_block_size);
-        next = (uint8_t *)mmap(NULL, next_block_size, PROT_READ | PROT_WRITE,
-                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
-        assert(next);
-        blocks.push_back(std::make_pair(next, next_block_size));
-        next_block_size <<= 1;
+static inline uint64_t mix64(uint64_t h) {
+    // MurmurHash3 finalizer
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+namespace std {
+template<>
+class hash<pair<LabelSetP, LabelSetP>> {
+  public:
+    size_t operator()(const pair<LabelSetP, LabelSetP> &labels) const {
+        return mix64((uintptr_t)labels.first * 31 + (uintptr_t)labels.second);
     }
+};
+}
 
-    T *alloc_imp() {
-        assert(blocks.size() > 0);
-        std::pair<uint8_t *, size_t>& block = blocks.back();
-        if (next + sizeof(T) > block.first + block.second) {
-            alloc_block();
-            assert(next != NULL);
-        }
+struct LabelSetHash {
+    size_t operator()(LabelSetP ls) const { return ls->hash; }
+};
 
-        T *result = new(next) T;
-        next += sizeof(T);
-        return result;
+// Equal sets have the same layout, so comparing the raw data is enough.
+static inline size_t label_set_data_bytes(LabelSetP ls) {
+    return ls->is_bitmap() ? ls->nwords * sizeof(uint64_t)
+                           : ls->count * sizeof(uint32_t);
+}
+
+struct LabelSetEqual {
+    bool operator()(LabelSetP a, LabelSetP b) const {
+        return a->hash == b->hash && a->count == b->count &&
+            a->base == b->base && a->nwords == b->nwords &&
+            memcmp(a->data, b->data, label_set_data_bytes(a)) == 0;
     }
+};
+
+static std::unordered_set<LabelSetP, LabelSetHash, LabelSetEqual> label_sets;
+static std::unordered_map<std::pair<LabelSetP, LabelSetP>, LabelSetP> memoized_unions;
+static size_t label_set_bytes = 0;
+// Reference counts of sets held outside the shadows; see label_set_ref.
+static std::unordered_map<LabelSetP, uint32_t> label_set_refs;
+
+// Scratch space for building a candidate set before looking it up.
+static std::vector<uint64_t> scratch;
 
-public:
-    ArenaAlloc() {
-        alloc_block();
+static LabelSet *label_set_scratch(size_t data_words) {
+    size_t header_words = sizeof(LabelSet) / sizeof(uint64_t);
+    scratch.assign(header_words + data_words, 0);
+    return (LabelSet *)scratch.data();
+}
+
+// Look the set in scratch up, copying it to the heap if it is new.
+static LabelSetP label_set_intern_scratch(void) {
+    LabelSet *candidate = (LabelSet *)scratch.data();
+    uint64_t h = 0;
+    for (uint32_t l : *candidate) {
+        h = mix64(h ^ l);
+    }
+    candidate->hash = h;
+
+    auto it = label_sets.find(candidate);
+    if (it != label_sets.end()) return *it;
+
+    size_t bytes = scratch.size() * sizeof(uint64_t);
+    LabelSet *ls = (LabelSet *)malloc(bytes);
+    assert(ls);
+    memcpy(ls, candidate, bytes);
+    label_sets.insert(ls);
+    label_set_bytes += bytes;
+    return ls;
+}
+
+// A bitmap pays off once it takes fewer bytes than the sorted array.
+static inline bool label_set_use_bitmap(uint32_t min, uint32_t max,
+        uint32_t count) {
+    uint64_t nwords = ((max - (min & ~63u)) >> 6) + 1;
+    return nwords * sizeof(uint64_t) < count * sizeof(uint32_t);
+}
+
+// labels must be sorted and unique.
+static LabelSetP label_set_intern_array(const uint32_t *labels, uint32_t n) {
+    if (n == 0) return nullptr;
+    uint32_t min = labels[0], max = labels[n - 1];
+
+    LabelSet *ls;
+    if (label_set_use_bitmap(min, max, n)) {
+        uint32_t base = min & ~63u;
+        uint32_t nwords = ((max - base) >> 6) + 1;
+        ls = label_set_scratch(nwords);
+        ls->base = base;
+        ls->nwords = nwords;
+        for (uint32_t i = 0; i < n; i++) {
+            uint32_t bit = labels[i] - base;
+            ls->data[bit >> 6] |= 1ULL << (bit & 63);
+        }
+    } else {
+        ls = label_set_scratch((n + 1) / 2);
+        memcpy(ls->data, labels, n * sizeof(uint32_t));
     }
+    ls->count = n;
+    return label_set_intern_scratch();
+}
 
-    const T *alloc() {
-        return alloc_imp();
+// words[0 .. nwords) cover labels base .. base + 64 * nwords.
+static LabelSetP label_set_intern_bitmap(uint32_t base, const uint64_t *words,
+        uint32_t nwords) {
+    while (nwords > 0 && words[nwords - 1] == 0) nwords--;
+    while (nwords > 0 && words[0] == 0) {
+        words++;
+        nwords--;
+        base += 64;
     }
+    if (nwords == 0) return nullptr;
 
-    const T *alloc(T &old) {
-        T *result = alloc_imp();
-        result->swap(old);
-        return result;
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < nwords; i++) {
+        count += __builtin_popcountll(words[i]);
     }
+    uint32_t min = base + __builtin_ctzll(words[0]);
+    uint32_t max = base + 64 * (nwords - 1) + 63 - __builtin_clzll(words[nwords - 1]);
 
-    ~ArenaAlloc() {
-        for (auto&& block : blocks) {
-            munmap(block.first, block.second);
+    LabelSet *ls;
+    if (label_set_use_bitmap(min, max, count)) {
+        ls = label_set_scratch(nwords);
+        ls->base = base;
+        ls->nwords = nwords;
+        memcpy(ls->data, words, nwords * sizeof(uint64_t));
+    } else {
+        ls = label_set_scratch((count + 1) / 2);
+        uint32_t *labels = (uint32_t *)ls->data;
+        uint32_t n = 0;
+        for (uint32_t i = 0; i < nwords; i++) {
+            for (uint64_t bits = words[i]; bits; bits &= bits - 1) {
+                labels[n++] = base + 64 * i + __builtin_ctzll(bits);
+            }
         }
     }
-};
+    ls->count = count;
+    return label_set_intern_scratch();
+}
 
-static ArenaAlloc<std::set<uint32_t>> LSA;
+static LabelSetP label_set_compute_union(LabelSetP ls1, LabelSetP ls2) {
+    if (!ls1->is_bitmap() && !ls2->is_bitmap()) {
+        static std::vector<uint32_t> merged;
+        merged.resize(ls1->count + ls2->count);
+        auto end = std::set_union(ls1->labels(), ls1->labels() + ls1->count,
+                ls2->labels(), ls2->labels() + ls2->count, merged.begin());
+        return label_set_intern_array(merged.data(), end - merged.begin());
+    }
 
-namespace std {
-template<>
-class hash<set<uint32_t>> {
-  public:
-    size_t operator()(const set<uint32_t> &labels) const {
-        uint64_t result = 0;
-        for (uint32_t l : labels) {
-            result ^= l;
-            result = result << 11 | result >> 53;
+    // At least one bitmap: OR everything into a bitmap over both ranges.
+    uint32_t lo = UINT32_MAX, hi = 0;
+    for (LabelSetP ls : { ls1, ls2 }) {
+        if (ls->is_bitmap()) {
+            lo = std::min(lo, ls->base);
+            hi = std::max(hi, ls->base + 64 * (ls->nwords - 1) + 63);
+        } else {
+            lo = std::min(lo, ls->labels()[0] & ~63u);
+            hi = std::max(hi, ls->labels()[ls->count - 1]);
         }
-        return result;
     }
-};
-
-template<>
-class hash<pair<LabelSetP, LabelSetP>> {
-  public:
-    size_t operator()(const pair<LabelSetP, LabelSetP> &labels) const {
-        return hash<LabelSetP>()(labels.first) ^
-            (hash<LabelSetP>()(labels.second) << (sizeof(LabelSetP) / 2));
+    static std::vector<uint64_t> words;
+    words.assign(((hi - lo) >> 6) + 1, 0);
+    for (LabelSetP ls : { ls1, ls2 }) {
+        if (ls->is_bitmap()) {
+            uint64_t *dst = words.data() + ((ls->base - lo) >> 6);
+            const uint64_t *src = ls->words();
+            for (uint32_t i = 0; i < ls->nwords; i++) {
+                dst[i] |= src[i];
+            }
+        } else {
+            for (uint32_t i = 0; i < ls->count; i++) {
+                uint32_t bit = ls->labels()[i] - lo;
+                words[bit >> 6] |= 1ULL << (bit & 63);
+            }
+        }
     }
-};
+    return label_set_intern_bitmap(lo, words.data(), words.size());
 }
 
-static std::unordered_set<std::set<uint32_t>> label_sets;
 LabelSetP label_set_union(LabelSetP ls1, LabelSetP ls2) {
-    static std::unordered_map<std::pair<LabelSetP, LabelSetP>, LabelSetP> memoized_unions;
-
     if (ls1 == ls2) {
         return ls1;
     } else if (ls1 && ls2) {
@@ -108,15 +208,7 @@ LabelSetP label_set_union(LabelSetP ls1, LabelSetP ls2) {
             }
         }
 
-        std::set<uint32_t> temp(*min);
-        for (auto l : *max) {
-            temp.insert(l);
-        }
-
-        // insert returns a pair <iterator, bool>; second is whether it happened
-        // first is iterator to new/existing element
-        auto it = label_sets.insert(temp).first;
-        const std::set<uint32_t> *result = &(*it);
+        LabelSetP result = label_set_compute_union(min, max);
 
         memoized_unions.insert(std::make_pair(minmax, result));
         return result;
@@ -128,12 +220,78 @@ LabelSetP label_set_union(LabelSetP ls1, LabelSetP ls2) {
 }
 
 LabelSetP label_set_singleton(uint32_t label) {
-    std::set<uint32_t> temp;
-    temp.insert(label);
-    return LSA.alloc(temp);
+    return label_set_intern_array(&label, 1);
+}
+
+void label_set_iter(LabelSetP ls, void (*leaf)(uint32_t, void *), void *user) {
+    if (!ls) return;
+    for (uint32_t l : *ls) {
+        leaf(l, user);
+    }
 }
 
 std::set<uint32_t> label_set_render_set(LabelSetP ls) {
-    if (ls) return *ls;
+    if (ls) return std::set<uint32_t>(ls->begin(), ls->end());
     else return std::set<uint32_t>();
 }
+
+void label_set_ref(LabelSetP ls) {
+    if (!ls) return;
+    if (label_set_refs[ls]++ == 0) {
+        const_cast<LabelSet *>(ls)->flags |= LABEL_SET_REFERENCED;
+    }
+}
+
+void label_set_unref(LabelSetP ls) {
+    if (!ls) return;
+    auto it = label_set_refs.find(ls);
+    assert(it != label_set_refs.end());
+    if (--it->second == 0) {
+        label_set_refs.erase(it);
+        const_cast<LabelSet *>(ls)->flags &= ~LABEL_SET_REFERENCED;
+    }
+}
+
+// Rough per-entry overhead of the hash tables (node, bucket, malloc header).
+#define LABEL_SET_TABLE_OVERHEAD 48
+
+size_t label_set_memory_usage(void) {
+    return label_set_bytes +
+        label_sets.size() * LABEL_SET_TABLE_OVERHEAD +
+        memoized_unions.size() *
+            (sizeof(std::pair<std::pair<LabelSetP, LabelSetP>, LabelSetP>) +
+             LABEL_SET_TABLE_OVERHEAD);
+}
+
+static inline bool label_set_live(LabelSetP ls) {
+    return ls->flags &
+        (LABEL_SET_MARKED | LABEL_SET_PINNED | LABEL_SET_REFERENCED);
+}
+
+size_t label_set_gc_sweep(void) {
+    for (auto it = memoized_unions.begin(); it != memoized_unions.end();) {
+        if (label_set_live(it->first.first) && label_set_live(it->first.second)
+                && label_set_live(it->second)) {
+            ++it;
+        } else {
+            it = memoized_unions.erase(it);
+        }
+    }
+
+    size_t freed = 0;
+    for (auto it = label_sets.begin(); it != label_sets.end();) {
+        LabelSet *ls = const_cast<LabelSet *>(*it);
+        if (label_set_live(ls)) {
+            ls->flags &= ~LABEL_SET_MARKED;
+            ++it;
+        } else {
+            it = label_sets.erase(it);
+            label_set_bytes -= sizeof(LabelSet) + (ls->is_bitmap()
+                    ? ls->nwords * sizeof(uint64_t)
+                    : (ls->count + 1) / 2 * sizeof(uint64_t));
+            free(ls);
+            freed++;
+        }
+    }
+    return freed;
+}
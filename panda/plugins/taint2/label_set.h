@@ -15,11 +15,108 @@ PANDAENDCOMMENT */
 #ifndef __LABEL_SET_H_
 #define __LABEL_SET_H_
 
+#include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <set>
 
+// An immutable set of taint labels. Label sets are interned: there is one
+// LabelSet per distinct set of labels, so they can be compared by pointer.
+//
+// Labels are stored right after the header, either as a sorted array or as
+// a bitmap over the range of labels the set spans (base .. base + 64 *
+// nwords), whichever is smaller. Dense sets such as runs of positional
+// file labels end up as bitmaps, everything else as arrays. The choice only
+// depends on the labels, so equal sets always have the same layout.
+//
+// Label sets are freed by a mark-and-sweep collector: mark every set still
+// referenced with label_set_gc_mark, then call label_set_gc_sweep. Pinned
+// sets are never freed, and referenced ones (label_set_ref) not until their
+// last reference is dropped.
+//
+// Everything here is inline, as taint_ops.cpp is also compiled to LLVM
+// bitcode against a different C++ library.
+#define LABEL_SET_MARKED 1
+#define LABEL_SET_PINNED 2
+#define LABEL_SET_REFERENCED 4
+
+class LabelSet {
+public:
+    uint64_t hash;
+    uint32_t count;   // number of labels
+    uint32_t base;    // bitmap only: label of bit 0, a multiple of 64
+    uint32_t nwords;  // bitmap only: number of words; 0 for arrays
+    uint32_t flags;   // LABEL_SET_* below
+    uint64_t data[];
+
+    bool is_bitmap() const { return nwords != 0; }
+    const uint32_t *labels() const { return (const uint32_t *)data; }
+    const uint64_t *words() const { return data; }
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    class const_iterator {
+        const LabelSet *ls;
+        uint32_t pos;   // index into labels, or word index for bitmaps
+        uint64_t bits;  // bitmaps: bits of words()[pos] not yet visited
+
+        void skip_empty_words() {
+            while (bits == 0 && pos < ls->nwords) {
+                if (++pos < ls->nwords) bits = ls->words()[pos];
+            }
+        }
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef uint32_t value_type;
+        typedef ptrdiff_t difference_type;
+        typedef const uint32_t *pointer;
+        typedef uint32_t reference;
+
+        const_iterator(const LabelSet *ls, uint32_t pos)
+            : ls(ls), pos(pos), bits(0) {
+            if (ls->is_bitmap() && pos < ls->nwords) {
+                bits = ls->words()[pos];
+                skip_empty_words();
+            }
+        }
+
+        uint32_t operator*() const {
+            return ls->is_bitmap() ? ls->base + 64 * pos + __builtin_ctzll(bits)
+                                   : ls->labels()[pos];
+        }
+
+        const_iterator &operator++() {
+            if (ls->is_bitmap()) {
+                bits &= bits - 1;
+                skip_empty_words();
+            } else {
+                pos++;
+            }
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const_iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        bool operator==(const const_iterator &o) const {
+            return pos == o.pos && bits == o.bits;
+        }
+        bool operator!=(const const_iterator &o) const { return !(*this == o); }
+    };
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const {
+        return const_iterator(this, is_bitmap() ? nwords : count);
+    }
+};
+
 extern "C" {
-typedef const std::set<uint32_t> *LabelSetP;
+typedef const LabelSet *LabelSetP;
 
 LabelSetP label_set_union(LabelSetP ls1, LabelSetP ls2);
 LabelSetP label_set_singleton(uint32_t label);
@@ -28,4 +125,21 @@ LabelSetP label_set_singleton(uint32_t label);
 void label_set_iter(LabelSetP ls, void (*leaf)(uint32_t, void *), void *user);
 std::set<uint32_t> label_set_render_set(LabelSetP ls);
 
+static inline void label_set_gc_mark(LabelSetP ls) {
+    if (ls) const_cast<LabelSet *>(ls)->flags |= LABEL_SET_MARKED;
+}
+// Keep ls alive for good, e.g. because its address has been logged.
+static inline void label_set_pin(LabelSetP ls) {
+    if (ls) const_cast<LabelSet *>(ls)->flags |= LABEL_SET_PINNED;
+}
+// Keep ls alive, e.g. for another plugin, until label_set_unref is called
+// as many times.
+void label_set_ref(LabelSetP ls);
+void label_set_unref(LabelSetP ls);
+// Bytes held by label sets and memoized unions.
+size_t label_set_memory_usage(void);
+// Free unmarked label sets and the memoized unions that involve them, and
+// clear all marks. Returns the number of sets freed.
+size_t label_set_gc_sweep(void);
+
 #endif
@@ -453,7 +453,8 @@ void PandaTaintVisitor::visitBasicBlock(BasicBlock &BB) {
         // reset second so it gets executed first (or will end up clearing an
         // abandoned frame instead of one about to use).
 
-        // Insert call to clear llvm shadow mem.
+        // Insert call to clear llvm shadow mem. This only touches slots
+        // that have held taint since they were last cleared.
         vector<Value *> args2{
             llvConst, const_uint64(ctx, 0),
             const_uint64(ctx, MAXREGSIZE * PST->getMaxSlot())
@@ -1240,6 +1241,53 @@ const static std::set<std::string> inoutFuncs{
     "helper_inb", "helper_inw", "helper_inl", "helper_inq",
     "helper_outb", "helper_outw", "helper_outl", "helper_outq"
 };
+
+static bool isGuestMemoryHelper(const std::string &name) {
+    return ldFuncs.count(name) > 0 || stFuncs.count(name) > 0 ||
+        (name.compare(0, 7, "helper_") == 0 && name.size() > 4 &&
+         name.compare(name.size() - 4, 4, "_mmu") == 0);
+}
+
+static bool helperAccessesMemory(Function *F);
+
+// Whether a call in F may reach guest memory. With skip_direct, calls to the
+// load/store helpers themselves don't count.
+static bool callsAccessMemory(Function &F, bool skip_direct) {
+    for (BasicBlock &BB : F) {
+        for (Instruction &I : BB) {
+            CallInst *CI = dyn_cast<CallInst>(&I);
+            if (!CI) continue;
+            Function *calledF = CI->getCalledFunction();
+            if (!calledF) return true;
+            if (calledF->isIntrinsic() ||
+                    calledF->getName().startswith("taint") ||
+                    calledF->getName().startswith("helper_panda_")) {
+                continue;
+            }
+            if (isGuestMemoryHelper(calledF->getName().str())) {
+                if (skip_direct) continue;
+                return true;
+            }
+            if (helperAccessesMemory(calledF)) return true;
+        }
+    }
+    return false;
+}
+
+static bool helperAccessesMemory(Function *F) {
+    static std::map<Function *, bool> memo;
+    auto it = memo.find(F);
+    if (it != memo.end()) return it->second;
+    memo[F] = false; // in case of recursion
+    bool result = callsAccessMemory(*F, false);
+    memo[F] = result;
+    return result;
+}
+
+bool tbCallsMemoryHelpers(Function &F) {
+    return callsAccessMemory(F, true);
+}
+
 const static std::set<std::string> unaryMathFuncs{
     "sin", "cos", "tan", "log", "__isinf", "__isnan", "rint", "floor", "abs",
     "fabs", "ceil", "exp2"
@@ -240,6 +240,10 @@ public:
     }
 };
 
+// Whether a TB's code calls helpers that access guest memory. Those accesses
+// are only seen by the taint ops in the TB's instrumented LLVM code.
+bool tbCallsMemoryHelpers(Function &F);
+
 } // End llvm namespace
 
 #endif
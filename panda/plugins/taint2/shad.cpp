@@ -38,8 +38,6 @@ Shad::Shad(std::string name, uint64_t max_size)
 
 Shad::~Shad() = default;
 
-typedef const std::set<uint32_t> *LabelSetP;
-
 FastShad::FastShad(std::string name, uint64_t labelsets) : Shad(name, labelsets)
 {
     uint64_t bytes = sizeof(TaintData) * labelsets;
@@ -62,6 +60,7 @@ FastShad::FastShad(std::string name, uint64_t labelsets) : Shad(name, labelsets)
 
     labels = array;
     orig_labels = array;
+    dirty.assign((labelsets + 64 * 64 - 1) / (64 * 64), 0);
 }
 
 // release all memory associated with this fast_shad.
@@ -73,6 +72,100 @@ FastShad::~FastShad() {
     }
 }
 
+bool FastShad::has_taint()
+{
+    for (uint64_t w = 0; w < dirty.size(); w++) {
+        while (dirty[w]) {
+            uint64_t start = 64 * (64 * w + __builtin_ctzll(dirty[w]));
+            uint64_t n = std::min<uint64_t>(64, size - start);
+            if (taint_data_clean_prefix(orig_labels + start, n) < n) {
+                return true;
+            }
+            dirty[w] &= dirty[w] - 1;
+        }
+    }
+    return false;
+}
+
+SparseShad::SparseShad(std::string name, uint64_t size) : Shad(name, size)
+{
+    empty_page = (ShadPage *)calloc(1, sizeof(ShadPage));
+    empty_table = (ShadTable *)calloc(1, sizeof(ShadTable));
+    assert(empty_page && empty_table);
+    for (uint64_t i = 0; i < SHAD_TABLE_SIZE; i++) {
+        empty_table->pages[i] = empty_page;
+    }
+
+    dir_size = (size + SHAD_TABLE_SPAN - 1) / SHAD_TABLE_SPAN;
+    dir = (ShadTable **)malloc(dir_size * sizeof(ShadTable *));
+    assert(dir);
+    for (uint64_t i = 0; i < dir_size; i++) {
+        dir[i] = empty_table;
+    }
+    printf("taint2: Allocating sparse shad for %" PRIu64 " bytes (%" PRIu64
+           " tables of %llu pages).\n", size, dir_size, SHAD_TABLE_SIZE);
+}
+
+SparseShad::~SparseShad()
+{
+    for (uint64_t t = 0; t < dir_size; t++) {
+        if (dir[t] == empty_table) continue;
+        for (uint64_t p = 0; p < SHAD_TABLE_SIZE; p++) {
+            if (dir[t]->pages[p] != empty_page) free(dir[t]->pages[p]);
+        }
+        free(dir[t]);
+    }
+    free(dir);
+    free(empty_table);
+    free(empty_page);
+}
+
+ShadPage *SparseShad::alloc_page(uint64_t addr)
+{
+    ShadTable *&table = dir[addr / SHAD_TABLE_SPAN];
+    if (table == empty_table) {
+        table = (ShadTable *)malloc(sizeof(ShadTable));
+        assert(table);
+        *table = *empty_table;
+    }
+    ShadPage *&page = table->pages[(addr / SHAD_PAGE_SIZE) % SHAD_TABLE_SIZE];
+    tassert(page == empty_page);
+    page = (ShadPage *)calloc(1, sizeof(ShadPage));
+    assert(page);
+    table->live++;
+    return page;
+}
+
+void SparseShad::free_page(uint64_t addr)
+{
+    ShadTable *&table = dir[addr / SHAD_TABLE_SPAN];
+    ShadPage *&page = table->pages[(addr / SHAD_PAGE_SIZE) % SHAD_TABLE_SIZE];
+    tassert(page != empty_page);
+    free(page);
+    page = empty_page;
+    if (--table->live == 0) {
+        free(table);
+        table = empty_table;
+    }
+}
+
+void SparseShad::gc_mark()
+{
+    for (uint64_t t = 0; t < dir_size; t++) {
+        for (uint64_t p = 0; dir[t] != empty_table && p < SHAD_TABLE_SIZE; p++) {
+            ShadPage *page = dir[t]->pages[p];
+            if (page == empty_page) continue;
+            if (page->live == 0) {
+                free_page((t * SHAD_TABLE_SIZE + p) * SHAD_PAGE_SIZE);
+                continue;
+            }
+            for (uint64_t i = 0; i < SHAD_PAGE_SIZE; i++) {
+                label_set_gc_mark(page->td[i].ls);
+            }
+        }
+    }
+}
+
 LazyShad::LazyShad(std::string name, uint64_t max_size) : Shad(name, max_size)
 {
     tassert(this->size > 0);
@@ -21,6 +21,7 @@ PANDAENDCOMMENT */
 #include <cstring>
 #include <string>
 #include <map>
+#include <vector>
 
 #ifdef TAINT2_DEBUG
 #include "qemu/osdep.h"
@@ -123,6 +124,36 @@ struct TaintData {
     }
 };
 
+// Number of leading items of tds[0 .. n) equal to TaintData(). Blocks are
+// checked with plain ORs, which the compiler turns into vector compares.
+static inline uint64_t taint_data_clean_prefix(const TaintData *tds, uint64_t n)
+{
+    uint64_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        uint64_t any = 0;
+        for (int j = 0; j < 8; j++) {
+            const TaintData &td = tds[i + j];
+            any |= (uintptr_t)td.ls | td.tcn | td.cb_mask | td.one_mask |
+                td.zero_mask;
+        }
+        if (any) break;
+    }
+    while (i < n && tds[i] == TaintData()) i++;
+    return i;
+}
+
+// Number of items of tds[0 .. n) that are not TaintData().
+static inline uint64_t taint_data_count_live(const TaintData *tds, uint64_t n)
+{
+    uint64_t live = 0;
+    for (uint64_t i = 0; i < n; i++) {
+        const TaintData &td = tds[i];
+        live += ((uintptr_t)td.ls | td.tcn | td.cb_mask | td.one_mask |
+                 td.zero_mask) != 0;
+    }
+    return live;
+}
+
 class Shad
 {
   protected:
@@ -165,17 +196,71 @@ class Shad
                     shad_src->range_tainted(src, size)))
             change = true;
 
-        for (uint64_t i = 0; i < size; i++) {
-            auto td = shad_src->query_full(src + i);
-
-            // don't report taint changes when store the taint data, as it is
-            // already taken care of for all bytes below
-            shad_dest->set_full_quiet(dest + i, td);
+        // don't report taint changes when store the taint data, as it is
+        // already taken care of for all bytes below
+        if (shad_dest == shad_src && dest > src && dest < src + size) {
+            // Overlapping move to higher addresses: go backwards so every
+            // item is read before it is overwritten, like memmove.
+            for (uint64_t i = size; i-- > 0;) {
+                shad_dest->set_full_quiet(dest + i,
+                                          shad_src->query_full(src + i));
+            }
+        } else {
+            for (uint64_t i = 0; i < size;) {
+                uint64_t n = shad_src->clean_run(src + i, size - i);
+                if (n) {
+                    shad_dest->remove_quiet(dest + i, n);
+                    i += n;
+                    continue;
+                }
+
+                n = size - i;
+                const TaintData *tds = shad_src->read_run(src + i, n);
+                if (tds) {
+                    shad_dest->write_run(dest + i, tds, n);
+                    i += n;
+                } else {
+                    shad_dest->set_full_quiet(dest + i,
+                                              shad_src->query_full(src + i));
+                    i++;
+                }
+            }
         }
 
         if (change) taint_state_changed(shad_dest, dest, size);
     }
 
+    // Sets size items from addr on to td, like calling set_full on each,
+    // but reports a change only once for the whole range, and only if the
+    // label set of some item in it changes.
+    void set_range(uint64_t addr, uint64_t size, TaintData td)
+    {
+        uint32_t newcard = 0;
+        if (td.ls != NULL) newcard = td.ls->size();
+        if (((max_tcn != 0) && (td.tcn > max_tcn)) ||
+            ((max_taintset_card != 0) && (newcard > max_taintset_card)))
+        {
+            // delete taint, if there is any, as things have gone too far
+            remove(addr, size);
+            return;
+        }
+
+        bool change = false;
+        if (track_taint_state) {
+            if (td.ls == NULL) {
+                change = range_tainted(addr, size);
+            } else {
+                // Only report the range if some item's label set differs.
+                for (uint64_t i = 0; i < size && !change; i++) {
+                    change = query(addr + i) != td.ls;
+                }
+            }
+        }
+        fill(addr, size, td);
+
+        if (change) taint_state_changed(this, addr, size);
+    }
+
     virtual void remove(uint64_t addr, uint64_t remove_size) = 0;
 
     // Removes the taint from remove_size items starting at address addr,
@@ -199,6 +284,39 @@ class Shad
 
     virtual uint32_t query_tcn(uint64_t addr) = 0;
 
+    // Mark every label set held here as live, for label_set_gc_sweep.
+    virtual void gc_mark() = 0;
+
+    // Number of items from addr on (at most limit) known to hold no taint
+    // data at all. 0 if unknown, so callers fall back to querying each item.
+    virtual uint64_t clean_run(uint64_t addr, uint64_t limit)
+    {
+        return 0;
+    }
+
+    // Bulk access for Shad::copy. read_run returns the items from addr on
+    // if they are stored contiguously, lowering n to how many are, or NULL.
+    virtual const TaintData *read_run(uint64_t addr, uint64_t &n)
+    {
+        return NULL;
+    }
+
+    // Quietly stores tds[0 .. n) from addr on; tds may overlap this shadow.
+    virtual void write_run(uint64_t addr, const TaintData *tds, uint64_t n)
+    {
+        for (uint64_t i = 0; i < n; i++) {
+            set_full_quiet(addr + i, tds[i]);
+        }
+    }
+
+    // Quietly stores td to n items from addr on.
+    virtual void fill(uint64_t addr, uint64_t n, TaintData td)
+    {
+        for (uint64_t i = 0; i < n; i++) {
+            set_full_quiet(addr + i, td);
+        }
+    }
+
     const char *name()
     {
         return _name.c_str();
@@ -213,18 +331,61 @@ class FastShad : public Shad
     TaintData *labels;
     TaintData *orig_labels;
 
+    // One bit per 64 items, set when taint data may have been stored there.
+    // Bits are cleared when a remove covers all 64 items, or when has_taint()
+    // finds them clean. Removes skip the items of clear bits, so clearing
+    // an LLVM frame that was hardly used costs next to nothing.
+    std::vector<uint64_t> dirty;
+
     TaintData *get_td_p(uint64_t guest_addr)
     {
         tassert(guest_addr < size);
         return &labels[guest_addr];
     }
 
+    void mark_dirty(uint64_t addr, uint64_t n)
+    {
+        if (n == 0) return;
+        uint64_t first = (labels - orig_labels + addr) / 64;
+        uint64_t last = (labels - orig_labels + addr + n - 1) / 64;
+        for (uint64_t c = first; c <= last; c++) {
+            dirty[c / 64] |= 1ULL << (c % 64);
+        }
+    }
+
+    // First item from i on (both indexes into orig_labels) whose bit is
+    // set, or end.
+    uint64_t next_dirty(uint64_t i, uint64_t end)
+    {
+        while (i < end) {
+            uint64_t c = i / 64;
+            uint64_t bits = dirty[c / 64] >> (c % 64);
+            if (bits & 1) return i;
+            i = 64 * (c + (bits ? __builtin_ctzll(bits) : 64 - c % 64));
+        }
+        return end;
+    }
+
+    void clear(uint64_t addr, uint64_t n)
+    {
+        uint64_t i = labels - orig_labels + addr, end = i + n;
+        while ((i = next_dirty(i, end)) < end) {
+            uint64_t c = i / 64;
+            uint64_t k = std::min(end, 64 * (c + 1)) - i;
+            memset(orig_labels + i, 0, k * sizeof(TaintData));
+            if (k == 64) dirty[c / 64] &= ~(1ULL << (c % 64));
+            i += k;
+        }
+    }
+
   protected:
     bool range_tainted(uint64_t addr, uint64_t size) override
     {
-        for (unsigned i = addr; i < addr + size; i++) {
-            if (get_td_p(i)->ls)
+        uint64_t i = labels - orig_labels + addr, end = i + size;
+        while ((i = next_dirty(i, end)) < end) {
+            if (orig_labels[i].ls)
                 return true;
+            i++;
         }
         return false;
     }
@@ -238,6 +399,7 @@ class FastShad : public Shad
     {
         taint_log("LABEL: %s[%lx] (%p)\n", name(), addr, ls);
         *get_td_p(addr) = TaintData(ls);
+        mark_dirty(addr, 1);
     }
 
     // Remove taint.
@@ -249,7 +411,7 @@ class FastShad : public Shad
         bool change = false;
         if (track_taint_state && range_tainted(addr, remove_size))
             change = true;
-        memset(get_td_p(addr), 0, remove_size * sizeof(TaintData));
+        clear(addr, remove_size);
 
         if (change)
             taint_state_changed(this, addr, remove_size);
@@ -260,7 +422,7 @@ class FastShad : public Shad
         tassert(addr + remove_size >= addr);
         tassert(addr + remove_size <= size);
 
-        memset(get_td_p(addr), 0, remove_size * sizeof(TaintData));
+        clear(addr, remove_size);
     }
 
     LabelSetP query(uint64_t addr) override
@@ -304,6 +466,7 @@ class FastShad : public Shad
         {
             bool change = !(td == *get_td_p(addr));
             labels[addr] = td;
+            if (!(td == TaintData())) mark_dirty(addr, 1);
             
             if (change) taint_state_changed(this, addr, 1);
         }
@@ -324,12 +487,50 @@ class FastShad : public Shad
     {
         tassert(addr < size);
         labels[addr] = td;
+        if (!(td == TaintData())) mark_dirty(addr, 1);
     }
 
     uint32_t query_tcn(uint64_t addr) override
     {
         return (query_full(addr)).tcn;
     }
+
+    void gc_mark() override
+    {
+        // Includes frames above the current one; they are simply kept a
+        // little longer.
+        for (uint64_t i = 0; i < size; i++) {
+            label_set_gc_mark(orig_labels[i].ls);
+        }
+    }
+
+    uint64_t clean_run(uint64_t addr, uint64_t limit) override
+    {
+        return taint_data_clean_prefix(get_td_p(addr), limit);
+    }
+
+    const TaintData *read_run(uint64_t addr, uint64_t &n) override
+    {
+        return get_td_p(addr);
+    }
+
+    void write_run(uint64_t addr, const TaintData *tds, uint64_t n) override
+    {
+        tassert(addr + n <= size);
+        memmove(get_td_p(addr), tds, n * sizeof(TaintData));
+        mark_dirty(addr, n);
+    }
+
+    void fill(uint64_t addr, uint64_t n, TaintData td) override
+    {
+        tassert(addr + n <= size);
+        std::fill(get_td_p(addr), get_td_p(addr) + n, td);
+        if (!(td == TaintData())) mark_dirty(addr, n);
+    }
+
+    // True if any item, in any frame, holds taint data. Cheap when nothing
+    // has been tainted since the last call that returned false.
+    bool has_taint();
 };
 
 class LazyShad : public Shad
@@ -369,9 +570,7 @@ class LazyShad : public Shad
         if (track_taint_state && range_tainted(addr, remove_size)) {
             change = true;
         }
-        for (uint64_t cur = addr; cur < addr + remove_size; cur++) {
-             labels.erase(cur);
-        }
+        remove_quiet(addr, remove_size);
 
         if (change) {
             taint_state_changed(this, addr, remove_size);
@@ -380,9 +579,9 @@ class LazyShad : public Shad
 
     void remove_quiet(uint64_t addr, uint64_t remove_size) override
     {
-        for (uint64_t cur = addr; cur < (addr + remove_size); cur++) {
-             labels.erase(cur);
-        }
+        auto end = addr + remove_size < addr ? labels.end()
+                                              : labels.lower_bound(addr + remove_size);
+        labels.erase(labels.lower_bound(addr), end);
     }
 
     LabelSetP query(uint64_t addr) override
@@ -445,6 +644,266 @@ class LazyShad : public Shad
     void pop_frame(uint64_t framesize) override
     {
     }
+
+    void gc_mark() override
+    {
+        for (auto &it : labels) {
+            label_set_gc_mark(it.second.ls);
+        }
+    }
+
+    uint64_t clean_run(uint64_t addr, uint64_t limit) override
+    {
+        auto it = labels.lower_bound(addr);
+        if (it == labels.end()) return limit;
+        return std::min(limit, it->first - addr);
+    }
+};
+
+// Sparse shadow memory for guest RAM: a two-level table of pages of
+// TaintData. Pages are only allocated once something is stored in them;
+// until then they point to a shared, never written, empty page (and whole
+// tables to a shared empty table), so most queries of untainted memory read
+// zeroes without allocating anything. Each page counts its non-empty items,
+// which lets range_tainted, remove and Shad::copy skip clean pages in O(1).
+#define SHAD_PAGE_BITS 12
+#define SHAD_TABLE_BITS 10
+#define SHAD_PAGE_SIZE (1ULL << SHAD_PAGE_BITS)
+#define SHAD_TABLE_SIZE (1ULL << SHAD_TABLE_BITS)
+#define SHAD_TABLE_SPAN (SHAD_PAGE_SIZE * SHAD_TABLE_SIZE)
+
+struct ShadPage {
+    uint64_t live; // items that are not TaintData()
+    TaintData td[SHAD_PAGE_SIZE];
+};
+
+struct ShadTable {
+    uint64_t live; // pages that are not the empty page
+    ShadPage *pages[SHAD_TABLE_SIZE];
+};
+
+class SparseShad : public Shad
+{
+  private:
+    ShadTable **dir;
+    uint64_t dir_size;
+    ShadPage *empty_page;
+    ShadTable *empty_table;
+
+    ShadPage *get_page(uint64_t addr)
+    {
+        tassert(addr < size);
+        return dir[addr / SHAD_TABLE_SPAN]->pages[(addr / SHAD_PAGE_SIZE) %
+                                                  SHAD_TABLE_SIZE];
+    }
+
+    // Out of line, in shad.cpp.
+    ShadPage *alloc_page(uint64_t addr);
+    void free_page(uint64_t addr);
+
+    // Items from addr to the end of its page (or its table, if that is
+    // empty), at most limit.
+    uint64_t page_run(uint64_t addr, uint64_t limit)
+    {
+        uint64_t span = dir[addr / SHAD_TABLE_SPAN] == empty_table
+                            ? SHAD_TABLE_SPAN : SHAD_PAGE_SIZE;
+        return std::min(limit, span - addr % span);
+    }
+
+    void store(uint64_t addr, const TaintData &td)
+    {
+        bool empty = td == TaintData();
+        ShadPage *page = get_page(addr);
+        if (page == empty_page) {
+            if (empty) return;
+            page = alloc_page(addr);
+        }
+        TaintData &cur = page->td[addr % SHAD_PAGE_SIZE];
+        if (cur == TaintData()) page->live++;
+        if (empty) page->live--;
+        cur = td;
+    }
+
+  protected:
+    bool range_tainted(uint64_t addr, uint64_t size) override
+    {
+        for (uint64_t end = addr + size; addr < end;) {
+            uint64_t n = page_run(addr, end - addr);
+            ShadPage *page = get_page(addr);
+            if (page->live) {
+                for (uint64_t i = 0; i < n; i++) {
+                    if (page->td[(addr + i) % SHAD_PAGE_SIZE].ls) return true;
+                }
+            }
+            addr += n;
+        }
+        return false;
+    }
+
+  public:
+    SparseShad(std::string name, uint64_t size);
+    ~SparseShad();
+
+    void label(uint64_t addr, LabelSetP ls) override
+    {
+        taint_log("LABEL: %s[%lx] (%p)\n", name(), addr, ls);
+        store(addr, TaintData(ls));
+    }
+
+    void remove(uint64_t addr, uint64_t remove_size) override
+    {
+        tassert(addr + remove_size >= addr);
+        tassert(addr + remove_size <= size);
+
+        bool change = false;
+        if (track_taint_state && range_tainted(addr, remove_size))
+            change = true;
+        remove_quiet(addr, remove_size);
+
+        if (change)
+            taint_state_changed(this, addr, remove_size);
+    }
+
+    void remove_quiet(uint64_t addr, uint64_t remove_size) override
+    {
+        tassert(addr + remove_size >= addr);
+        tassert(addr + remove_size <= size);
+
+        for (uint64_t end = addr + remove_size; addr < end;) {
+            uint64_t n = page_run(addr, end - addr);
+            ShadPage *page = get_page(addr);
+            if (page->live == 0) {
+                // nothing to do
+            } else if (n == SHAD_PAGE_SIZE) {
+                free_page(addr);
+            } else {
+                for (uint64_t i = 0; i < n; i++) {
+                    TaintData &cur = page->td[(addr + i) % SHAD_PAGE_SIZE];
+                    if (!(cur == TaintData())) {
+                        cur = TaintData();
+                        page->live--;
+                    }
+                }
+            }
+            addr += n;
+        }
+    }
+
+    LabelSetP query(uint64_t addr) override
+    {
+        return get_page(addr)->td[addr % SHAD_PAGE_SIZE].ls;
+    }
+
+    // RAM has no frames.
+    void reset_frame() override
+    {
+    }
+
+    void push_frame(uint64_t framesize) override
+    {
+    }
+
+    void pop_frame(uint64_t framesize) override
+    {
+    }
+
+    TaintData query_full(uint64_t addr) override
+    {
+        return get_page(addr)->td[addr % SHAD_PAGE_SIZE];
+    }
+
+    void set_full(uint64_t addr, TaintData td) override
+    {
+        tassert(addr < size);
+
+        uint32_t newcard = 0;
+        if (td.ls != NULL) newcard = td.ls->size();
+        if (((max_tcn == 0) || (td.tcn <= max_tcn)) &&
+            ((max_taintset_card == 0) || (newcard <= max_taintset_card)))
+        {
+            bool change = !(td == query_full(addr));
+            store(addr, td);
+
+            if (change) taint_state_changed(this, addr, 1);
+        }
+        else
+        {
+            // delete taint, if there is any, as things have gone too far
+            if (range_tainted(addr, 1))
+            {
+                // remove will take care of taint_state_changed, unless they
+                // don't care to be informed of removals
+                remove(addr, 1);
+            }
+        }
+    }
+
+    // Set taint quietly - ie. no taint change report is made.
+    void set_full_quiet(uint64_t addr, TaintData td) override
+    {
+        tassert(addr < size);
+        store(addr, td);
+    }
+
+    uint32_t query_tcn(uint64_t addr) override
+    {
+        return (query_full(addr)).tcn;
+    }
+
+    // Also gives back pages that have become empty one item at a time.
+    void gc_mark() override;
+
+    uint64_t clean_run(uint64_t addr, uint64_t limit) override
+    {
+        uint64_t n = page_run(addr, limit);
+        ShadPage *page = get_page(addr);
+        if (page->live == 0) return n;
+        return taint_data_clean_prefix(&page->td[addr % SHAD_PAGE_SIZE], n);
+    }
+
+    const TaintData *read_run(uint64_t addr, uint64_t &n) override
+    {
+        n = std::min<uint64_t>(n, SHAD_PAGE_SIZE - addr % SHAD_PAGE_SIZE);
+        return &get_page(addr)->td[addr % SHAD_PAGE_SIZE];
+    }
+
+    void write_run(uint64_t addr, const TaintData *tds, uint64_t n) override
+    {
+        for (uint64_t end = addr + n; addr < end;) {
+            uint64_t k = std::min<uint64_t>(end - addr,
+                SHAD_PAGE_SIZE - addr % SHAD_PAGE_SIZE);
+            uint64_t live = taint_data_count_live(tds, k);
+            if (live == 0) {
+                remove_quiet(addr, k);
+            } else {
+                ShadPage *page = get_page(addr);
+                if (page == empty_page) page = alloc_page(addr);
+                TaintData *dst = &page->td[addr % SHAD_PAGE_SIZE];
+                page->live = page->live - taint_data_count_live(dst, k) + live;
+                memmove(dst, tds, k * sizeof(TaintData));
+            }
+            addr += k;
+            tds += k;
+        }
+    }
+
+    void fill(uint64_t addr, uint64_t n, TaintData td) override
+    {
+        if (td == TaintData()) {
+            remove_quiet(addr, n);
+            return;
+        }
+        for (uint64_t end = addr + n; addr < end;) {
+            uint64_t k = std::min<uint64_t>(end - addr,
+                SHAD_PAGE_SIZE - addr % SHAD_PAGE_SIZE);
+            ShadPage *page = get_page(addr);
+            if (page == empty_page) page = alloc_page(addr);
+            TaintData *dst = &page->td[addr % SHAD_PAGE_SIZE];
+            page->live = page->live - taint_data_count_live(dst, k) + k;
+            std::fill(dst, dst + k, td);
+            addr += k;
+        }
+    }
 };
 
 #endif
@@ -32,8 +32,6 @@ PANDAENDCOMMENT */
 
 #include "shad_dir_64.h"
 
-typedef const std::set<uint32_t> *LabelSetP;
-
 // 64-bit addresses
 // create a new table
 // if table_table==1 then this is a table of tables,
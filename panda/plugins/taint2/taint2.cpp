@@ -36,7 +36,9 @@
 #undef NDEBUG
 #endif
 
+#include <algorithm>
 #include <iostream>
+#include <unordered_set>
 
 #include "panda/plugin.h"
 #include "panda/tcg-llvm.h"
@@ -88,6 +90,8 @@ PPP_CB_BOILERPLATE(on_taint_change);
 bool track_taint_state = false;
 uint32_t max_tcn = 0;          // ie disabled
 uint32_t max_taintset_card = 0;   // ie disabled - there is no maximum
+uint32_t label_set_gc_mb = 1024;  // collect label sets above this (0=never)
+static size_t next_label_set_gc = 0;
 
 // more i386 condition code adjustment information
 #if defined(TARGET_I386)
@@ -144,21 +148,69 @@ bool optimize_llvm = true;
 extern bool inline_taint;
 bool debug_taint = false;
 bool detaint_cb0_bytes = false;
+bool tcg_fast_path = true;
+
+// TBs whose helpers access guest memory; these always run as LLVM code.
+static std::unordered_set<TranslationBlock *> llvm_only_tbs;
 
 /*
  * These memory callbacks are only for whole-system mode.  User-mode memory
  * accesses are captured by IR instrumentation.
+ *
+ * While a TB runs as TCG code no guest register holds taint, so stores only
+ * ever write untainted data, and a load of tainted data has to be redone by
+ * the instrumented LLVM code.
  */
+static bool ram_range_clean(uint64_t addr, uint64_t size) {
+    if (addr + size > shadow->ram.get_size()) return true;
+    while (size > 0) {
+        uint64_t n = shadow->ram.clean_run(addr, size);
+        if (n == 0) return false;
+        addr += n;
+        size -= n;
+    }
+    return true;
+}
+
 int phys_mem_write_callback(CPUState *cpu, target_ulong pc, target_ulong addr, target_ulong size, void *buf) {
+    if (!executing_llvm) {
+        if (taintEnabled && !ram_range_clean(addr, size)) {
+            shadow->ram.remove(addr, size);
+        }
+        return 0;
+    }
     taint_memlog_push(&taint_memlog, addr);
     return 0;
 }
 
 int phys_mem_read_callback(CPUState *cpu, target_ulong pc, target_ulong addr, target_ulong size) {
+    if (!executing_llvm) {
+        if (taintEnabled && !ram_range_clean(addr, size)) {
+            panda_restart_in_llvm(cpu);
+        }
+        return 0;
+    }
     taint_memlog_push(&taint_memlog, addr);
     return 0;
 }
 
+int after_block_translate(CPUState *cpu, TranslationBlock *tb) {
+    if (tb->llvm_function && llvm::tbCallsMemoryHelpers(*tb->llvm_function)) {
+        llvm_only_tbs.insert(tb);
+    } else {
+        llvm_only_tbs.erase(tb);
+    }
+    return 0;
+}
+
+// Run the TCG code of a TB, skipping all taint propagation, when no taint
+// can flow through it: no guest register holds taint and all its memory
+// accesses go through the callbacks above.
+static bool taint2_exec_llvm(CPUState *cpu, TranslationBlock *tb) {
+    return llvm_only_tbs.count(tb) > 0 || shadow->grv.has_taint() ||
+        shadow->gsv.has_taint() || shadow->ret.has_taint();
+}
+
 int replay_hd_transfer_callback(CPUState *cpu, uint32_t type, uint64_t src_addr,
                                 uint64_t dst_addr, uint32_t num_bytes)
 {
@@ -293,6 +345,10 @@ void taint2_enable_taint(void) {
     panda_register_callback(taint2_plugin, PANDA_CB_PHYS_MEM_BEFORE_WRITE, pcb);
     pcb.asid_changed = asid_changed_callback;
     panda_register_callback(taint2_plugin, PANDA_CB_ASID_CHANGED, pcb);
+    if (tcg_fast_path) {
+        pcb.after_block_translate = after_block_translate;
+        panda_register_callback(taint2_plugin, PANDA_CB_AFTER_BLOCK_TRANSLATE, pcb);
+    }
 
     pcb.replay_hd_transfer = replay_hd_transfer_callback;
     panda_register_callback(taint2_plugin, PANDA_CB_REPLAY_HD_TRANSFER, pcb);
@@ -312,6 +368,9 @@ void taint2_enable_taint(void) {
 
     if (shadow) delete shadow;
     shadow = new ShadowState();
+    if (tcg_fast_path) {
+        panda_set_llvm_exec_filter(taint2_exec_llvm);
+    }
 
     // Initialize memlog.
     memset(&taint_memlog, 0, sizeof(taint_memlog));
@@ -508,8 +567,39 @@ void taint_state_changed(Shad *shad, uint64_t shad_addr, uint64_t size)
     PPP_RUN_CB(on_taint_change, addr, size);
 }
 
+// Free label sets no longer referenced from any shadow. Only called between
+// blocks, when no taint operation holds a label set.
+static void collect_label_sets(void) {
+    shadow->ram.gc_mark();
+    shadow->llv.gc_mark();
+    shadow->ret.gc_mark();
+    shadow->grv.gc_mark();
+    shadow->gsv.gc_mark();
+    shadow->hd.gc_mark();
+    shadow->io.gc_mark();
+#if defined(TARGET_I386)
+    for (auto &td : ccDstTaint) label_set_gc_mark(td.ls);
+    for (auto &td : ccSrcTaint) label_set_gc_mark(td.ls);
+    for (auto &td : ccSrc2Taint) label_set_gc_mark(td.ls);
+    for (auto &td : ccOpTaint) label_set_gc_mark(td.ls);
+#endif
+
+    size_t before = label_set_memory_usage();
+    size_t freed = label_set_gc_sweep();
+    size_t after = label_set_memory_usage();
+    // Don't collect again until live data has at least doubled.
+    next_label_set_gc = std::max((size_t)label_set_gc_mb << 20, 2 * after);
+    std::cerr << PANDA_MSG "label set gc: freed " << freed << " sets, "
+        << ((before - after) >> 20) << " MB; " << (after >> 20)
+        << " MB live" << std::endl;
+}
+
 bool before_block_exec_invalidate_opt(CPUState *cpu, TranslationBlock *tb) {
     if (taintEnabled) {
+        if (label_set_gc_mb &&
+                label_set_memory_usage() > next_label_set_gc) {
+            collect_label_sets();
+        }
         return tb->llvm_tc_ptr ? false : true /* invalidate! */;
     }
     return false;
@@ -561,12 +651,18 @@ bool init_plugin(void *self) {
     std::cerr << PANDA_MSG "taint debugging " << PANDA_FLAG_STATUS(debug_taint) << std::endl;
     detaint_cb0_bytes = panda_parse_bool_opt(args, "detaint_cb0", "detaint bytes whose control mask bits are 0");
     std::cerr << PANDA_MSG "detaint if control bits 0 " << PANDA_FLAG_STATUS(detaint_cb0_bytes) << std::endl;
+    tcg_fast_path = !panda_parse_bool_opt(args, "no_fast_path", "always run instrumented code, even where taint cannot flow");
+    std::cerr << PANDA_MSG "uninstrumented code where taint cannot flow " << PANDA_FLAG_STATUS(tcg_fast_path) << std::endl;
     max_tcn = panda_parse_uint32_opt(args, "max_taintset_compute_number", 0,
         "stop propagating taint after it goes through this number of computations (0=never stop)");
     std::cerr << PANDA_MSG "maximum taint compute number (0=unlimited) " << max_tcn << std::endl;
     max_taintset_card = panda_parse_uint32_opt(args, "max_taintset_card", 0,
         "maximum size a label set can reach before stop tracking taint on it (0=never stop)");
     std::cerr << PANDA_MSG "maximum taintset cardinality (0=unlimited) " << max_taintset_card << std::endl;
+    label_set_gc_mb = panda_parse_uint32_opt(args, "label_set_gc_mb", 1024,
+        "free unreferenced label sets once they take this many MB (0=never)");
+    next_label_set_gc = (size_t)label_set_gc_mb << 20;
+    std::cerr << PANDA_MSG "label set gc watermark MB (0=never) " << label_set_gc_mb << std::endl;
     
     // load dependencies
     panda_require("callstack_instr");
@@ -27,8 +27,6 @@
 #include "shad_dir_64.h"
 #include "taint_defines.h"
 
-typedef const std::set<uint32_t> *LabelSetP;
-
 typedef void (*on_branch2_t) (Addr, uint64_t);
 typedef void (*on_indirect_jump_t) (Addr, uint64_t);
 typedef void (*on_taint_change_t) (Addr, uint64_t);
@@ -39,7 +37,7 @@ typedef void (*on_ptr_store_t) (Addr, uint64_t, uint64_t);
 struct ShadowState {
     uint64_t prev_bb; // label for previous BB.
     uint32_t num_vals;
-    FastShad ram;
+    SparseShad ram;
     FastShad llv;  // LLVM registers, with multiple frames
     FastShad ret;  // LLVM return value, also temp register
     FastShad grv;  // guest general purpose registers
@@ -89,6 +89,20 @@ void taint2_labelset_reg_iter(int reg_num, int offset, int (*app)(uint32_t el, v
 // fn should return 0 to continue iteration
 void taint2_labelset_io_iter(uint64_t ia, int (*app)(uint32_t el, void *stuff1), void *stuff2);
 
+// returns the label set at addr, or NULL if untainted. label sets that no
+// shadow refers to any more may be freed between basic blocks (see
+// label_set_gc_mb), so only use the result within the current callback,
+// unless you hold a reference to it with taint2_labelset_ref.
+LabelSetP taint2_query_labelset(Addr addr);
+
+// keep ls valid until a matching taint2_labelset_unref
+void taint2_labelset_ref(LabelSetP ls);
+void taint2_labelset_unref(LabelSetP ls);
+
+// apply this fn to each of the labels in ls
+// fn should return 0 to continue iteration
+void taint2_labelset_iter(LabelSetP ls, int (*app)(uint32_t el, void *stuff1), void *stuff2);
+
 // just tells how big that labels_applied set will be
 uint32_t taint2_num_labels_applied(void);
 
@@ -397,6 +397,22 @@ void taint2_labelset_io_iter(uint64_t ia, int (*app)(uint32_t el, void *stuff1),
     tp_ls_iter(tp_labelset_get(make_iaddr(ia)), app, stuff2);
 }
 
+LabelSetP taint2_query_labelset(Addr a) {
+    return tp_labelset_get(a);
+}
+
+void taint2_labelset_ref(LabelSetP ls) {
+    label_set_ref(ls);
+}
+
+void taint2_labelset_unref(LabelSetP ls) {
+    label_set_unref(ls);
+}
+
+void taint2_labelset_iter(LabelSetP ls, int (*app)(uint32_t el, void *stuff1), void *stuff2) {
+    tp_ls_iter(ls, app, stuff2);
+}
+
 void taint2_track_taint_state(void) {
     track_taint_state = true;
 }
@@ -440,6 +456,9 @@ Panda__TaintQuery *taint2_query_pandalog (Addr a, uint32_t offset) {
 
         // Returns true if insertion took place, i.e. we should plog this LS.
         if (ls_returned.insert(ls).second) {
+            // The pointer identifies the set in the log from now on, so
+            // the collector must not free it and reuse its address.
+            label_set_pin(ls);
             // we only want to actually write a particular set contents to pandalog once
             // this ls hasn't yet been written to pandalog
             // write out mapping from ls pointer to labelset contents
@@ -50,6 +50,11 @@ void taint2_labelset_reg_iter(int reg_num, int offset, int (*app)(uint32_t el, v
 void taint2_labelset_io_iter(uint64_t ia, int (*app)(uint32_t el, void *stuff1), void *stuff2);
 void taint2_labelset_llvm_iter(int reg_num, int offset, int (*app)(uint32_t el, void *stuff1), void *stuff2);
 
+LabelSetP taint2_query_labelset(Addr a);
+void taint2_labelset_ref(LabelSetP ls);
+void taint2_labelset_unref(LabelSetP ls);
+void taint2_labelset_iter(LabelSetP ls, int (*app)(uint32_t el, void *stuff1), void *stuff2);
+
 uint32_t taint2_num_labels_applied(void);
 
 void taint2_track_taint_state(void);
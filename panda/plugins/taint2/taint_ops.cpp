@@ -204,6 +204,8 @@ void taint_parallel_compute(Shad *shad, uint64_t dest, uint64_t ignored,
 static inline TaintData mixed_labels(Shad *shad, uint64_t addr, uint64_t size,
                                      bool increment_tcn)
 {
+    if (shad->clean_run(addr, size) == size) return TaintData();
+
     TaintData td(shad->query_full(addr));
     for (uint64_t i = 1; i < size; ++i) {
         td = TaintData::make_union(td, shad->query_full(addr + i), false);
@@ -216,9 +218,10 @@ static inline TaintData mixed_labels(Shad *shad, uint64_t addr, uint64_t size,
 static inline void bulk_set(Shad *shad, uint64_t addr, uint64_t size,
                             TaintData td)
 {
-    uint64_t i;
-    for (i = 0; i < size; ++i) {
-        shad->set_full(addr + i, td);
+    if (size == 1) {
+        shad->set_full(addr, td);
+    } else {
+        shad->set_range(addr, size, td);
     }
 }
 
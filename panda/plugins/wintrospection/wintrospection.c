@@ -87,6 +87,32 @@ static PTR(*get_kpcr)(CPUState *cpu);
 // Function pointer, returns handle table entry.  OS-specific.
 static HandleObject *(*get_handle_object)(CPUState *cpu, PTR eproc, uint32_t handle);
 
+// Introspection cache. Results are tagged with the cache_version that was
+// current when they were read; the version is bumped on every asid change
+// and, with cache_watch, on every kernel write to an EPROCESS field the
+// cached results were read from. The current process is keyed on
+// (asid, current KTHREAD); without cache_watch, changes to its EPROCESS
+// under the same key are not seen until the next asid change.
+// The process list can change without an asid change, so it is only
+// cached when kernel writes are watched.
+static bool cache_enabled;
+static bool cache_watch;
+static uint64_t cache_version = 1;
+
+static uint64_t current_proc_version;
+static target_ulong current_proc_asid;
+static PTR current_proc_thread;
+static OsiProc *current_proc;
+
+static GArray *procs_cache;
+static uint64_t procs_cache_version;
+
+// Addresses (aligned to sizeof(PTR)) of the fields the cache was filled from.
+static GHashTable *watched;
+
+static PTR get_current_kthread(CPUState *cpu);
+static PTR get_kthread_proc(CPUState *cpu, PTR thread);
+
 
 char *make_pagedstr(void) {
     char *m = g_strdup("(paged)");
@@ -142,29 +168,69 @@ void add_mod(CPUState *cpu, GArray *ms, PTR mod, bool ignore_basename) {
     g_array_append_val(ms, m);
 }
 
-void on_get_current_process(CPUState *cpu, OsiProc **out) {
-    PTR eproc = get_current_proc(cpu);
-    if(eproc) {
-        OsiProc *p = (OsiProc *)g_malloc(sizeof(OsiProc));
-        fill_osiproc(cpu, p, eproc);
-        *out = p;
-    } else {
-        *out = NULL;
+static void watch_range(PTR addr, size_t size) {
+    for (PTR a = addr & ~(PTR)(sizeof(PTR) - 1); a < addr + size; a += sizeof(PTR)) {
+        g_hash_table_add(watched, GUINT_TO_POINTER(a));
     }
 }
 
-void on_get_current_process_handle(CPUState *cpu, OsiProcHandle **out) {
-    PTR eproc = get_current_proc(cpu);
-    if(eproc) {
-        OsiProcHandle *h = (OsiProcHandle *)g_malloc(sizeof(OsiProcHandle));
-        fill_osiprochandle(cpu, h, eproc);
-        *out = h;
-    } else {
-        *out = NULL;
+// Watches the EPROCESS fields read by fill_osiproc() and get_next_proc().
+static void watch_eproc(PTR eproc) {
+    watch_range(eproc + eproc_links_off, 2 * sizeof(PTR));
+    watch_range(eproc + eproc_name_off, 16);
+    watch_range(eproc + eproc_pid_off, sizeof(PTR));
+    watch_range(eproc + eproc_ppid_off, sizeof(PTR));
+    watch_range(eproc + EPROC_DTB_OFF, sizeof(PTR));
+}
+
+static void cache_invalidate(void) {
+    cache_version++;
+    g_hash_table_remove_all(watched);
+}
+
+static int osi_cache_asid_changed(CPUState *cpu, target_ulong oldval, target_ulong newval) {
+    cache_invalidate();
+    return 0;
+}
+
+static int osi_cache_mem_write(CPUState *cpu, target_ulong pc, target_ulong addr,
+                               target_ulong size, void *buf) {
+    if (g_hash_table_size(watched) == 0 || !panda_in_kernel(cpu)) return 0;
+    for (PTR a = addr & ~(PTR)(sizeof(PTR) - 1); a < addr + size; a += sizeof(PTR)) {
+        if (g_hash_table_contains(watched, GUINT_TO_POINTER(a))) {
+            cache_invalidate();
+            break;
+        }
     }
+    return 0;
 }
 
-void on_get_processes(CPUState *cpu, GArray **out) {
+// Returns the cached current process, reading it from the guest if the
+// cache is stale. The result is owned by the cache and may be NULL.
+static OsiProc *cached_current_process(CPUState *cpu) {
+    PTR thread = get_current_kthread(cpu);
+    if (thread == 0) return NULL;
+    target_ulong asid = panda_current_asid(cpu);
+    if (current_proc_version != cache_version ||
+        current_proc_asid != asid || current_proc_thread != thread) {
+        // Don't remember failures; KTHREAD.Process is sometimes not set yet.
+        PTR eproc = get_kthread_proc(cpu, thread);
+        if (eproc == 0) return NULL;
+        if (current_proc == NULL) {
+            current_proc = (OsiProc *)g_malloc0(sizeof(OsiProc));
+        }
+        free_osiproc_contents(current_proc);
+        fill_osiproc(cpu, current_proc, eproc);
+        if (cache_watch) watch_eproc(eproc);
+        current_proc_version = cache_version;
+        current_proc_asid = asid;
+        current_proc_thread = thread;
+    }
+    return current_proc;
+}
+
+// Reads the process list from the guest.
+static void get_processes(CPUState *cpu, GArray **out) {
     OsiProc p;
     PTR first, current;
 
@@ -181,7 +247,7 @@ void on_get_processes(CPUState *cpu, GArray **out) {
     g_array_free(*out, true);
     // g_array_sized_new() args: zero_term, clear, element_sz, reserved_sz
     *out = g_array_sized_new(false, false, sizeof(OsiProc), 128);
-    g_array_set_clear_func(*out, (GDestroyNotify)free_osiproc);
+    g_array_set_clear_func(*out, (GDestroyNotify)free_osiproc_contents);
 
     do {
         // One of these will be the loop head,
@@ -191,6 +257,7 @@ void on_get_processes(CPUState *cpu, GArray **out) {
             fill_osiproc(cpu, &p, current);
             g_array_append_val(*out, p);
         }
+        if (cache_watch) watch_eproc(current);
         current = get_next_proc(cpu, current);
     } while (current != (uintptr_t)NULL && current != first);
 
@@ -202,6 +269,45 @@ error:
     return;
 }
 
+void on_get_current_process(CPUState *cpu, OsiProc **out) {
+    if (cache_enabled) {
+        *out = copy_osiproc(cached_current_process(cpu), NULL);
+        return;
+    }
+    PTR eproc = get_current_proc(cpu);
+    if(eproc) {
+        OsiProc *p = (OsiProc *)g_malloc(sizeof(OsiProc));
+        fill_osiproc(cpu, p, eproc);
+        *out = p;
+    } else {
+        *out = NULL;
+    }
+}
+
+void on_get_current_process_handle(CPUState *cpu, OsiProcHandle **out) {
+    PTR eproc = get_current_proc(cpu);
+    if(eproc) {
+        OsiProcHandle *h = (OsiProcHandle *)g_malloc(sizeof(OsiProcHandle));
+        fill_osiprochandle(cpu, h, eproc);
+        *out = h;
+    } else {
+        *out = NULL;
+    }
+}
+
+void on_get_processes(CPUState *cpu, GArray **out) {
+    if (cache_watch) {
+        if (procs_cache_version != cache_version) {
+            get_processes(cpu, &procs_cache);
+            procs_cache_version = cache_version;
+        }
+        g_array_free(*out, true);  // safe even when *out == NULL
+        *out = copy_osiprocs_g(procs_cache);
+        return;
+    }
+    get_processes(cpu, out);
+}
+
 void on_get_current_thread(CPUState *cpu, OsiThread **out) {
     OsiProc *p = NULL;
     CPUArchState *env = (CPUArchState *)first_cpu->env_ptr;
@@ -267,13 +373,13 @@ uint32_t get_obj_type_offset(void) { return obj_type_offset; }
 
 uint32_t get_pid(CPUState *cpu, PTR eproc) {
     uint32_t pid;
-    if(-1 == panda_virtual_memory_rw(cpu, eproc+eproc_pid_off, (uint8_t *)&pid, 4, false)) return 0;
+    if(-1 == panda_virtual_read_u32(cpu, eproc+eproc_pid_off, &pid)) return 0;
     return pid;
 }
 
 PTR get_ppid(CPUState *cpu, PTR eproc) {
     PTR ppid;
-    if(-1 == panda_virtual_memory_rw(cpu, eproc+eproc_ppid_off, (uint8_t *)&ppid, sizeof(PTR), false)) return 0;
+    if(-1 == panda_virtual_read_u32(cpu, eproc+eproc_ppid_off, &ppid)) return 0;
     return ppid;
 }
 
@@ -332,12 +438,16 @@ bool is_valid_process(CPUState *cpu, PTR eproc) {
 }
 
 
-uint32_t get_current_proc(CPUState *cpu) {
-    PTR thread, proc;
+// Returns KPCR->CurrentThread, or 0 if it can't be read.
+static PTR get_current_kthread(CPUState *cpu) {
+    PTR thread;
     PTR kpcr = get_kpcr(cpu);
-
-    // Read KPCR->CurrentThread->Process
     if (-1 == panda_virtual_memory_rw(cpu, kpcr+KPCR_CURTHREAD_OFF, (uint8_t *)&thread, sizeof(PTR), false)) return 0;
+    return thread;
+}
+
+static PTR get_kthread_proc(CPUState *cpu, PTR thread) {
+    PTR proc;
     if (-1 == panda_virtual_memory_rw(cpu, thread+get_kthread_kproc_off(), (uint8_t *)&proc, sizeof(PTR), false)) return 0;
 
     // Sometimes, proc == 0 here.  Is there a better way to do this?
@@ -345,10 +455,17 @@ uint32_t get_current_proc(CPUState *cpu) {
     return is_valid_process(cpu, proc) ? proc : 0;
 }
 
+uint32_t get_current_proc(CPUState *cpu) {
+    // Read KPCR->CurrentThread->Process
+    PTR thread = get_current_kthread(cpu);
+    if (thread == 0) return 0;
+    return get_kthread_proc(cpu, thread);
+}
+
 // Process introspection
 PTR get_next_proc(CPUState *cpu, PTR eproc) {
     PTR next;
-    if (-1 == panda_virtual_memory_rw(cpu, eproc+eproc_links_off, (uint8_t *)&next, sizeof(PTR), false))
+    if (-1 == panda_virtual_read_u32(cpu, eproc+eproc_links_off, &next))
         return 0;
     next -= eproc_links_off;
     return next;
@@ -611,6 +728,27 @@ bool init_plugin(void *self) {
     PPP_REG_CB("osi", on_get_process_pid, on_get_process_pid);
     PPP_REG_CB("osi", on_get_process_ppid, on_get_process_ppid);
 
+    // Caching is off by default. cache keeps the current process until the
+    // next asid change; cache_watch also caches the process list and drops
+    // cached results when a field they came from is written, at the price
+    // of memory callbacks.
+    panda_arg_list *args = panda_get_args("wintrospection");
+    cache_watch = panda_parse_bool_opt(args, "cache_watch", "cache processes, invalidating them on kernel writes");
+    cache_enabled = panda_parse_bool_opt(args, "cache", "cache the current process until the next asid change") || cache_watch;
+    panda_free_args(args);
+
+    watched = g_hash_table_new(NULL, NULL);
+    if (cache_enabled) {
+        panda_cb pcb;
+        pcb.asid_changed = osi_cache_asid_changed;
+        panda_register_callback(self, PANDA_CB_ASID_CHANGED, pcb);
+        if (cache_watch) {
+            pcb.virt_mem_after_write = osi_cache_mem_write;
+            panda_register_callback(self, PANDA_CB_VIRT_MEM_AFTER_WRITE, pcb);
+            panda_enable_memcb();
+        }
+    }
+
     return true;
 #else
     fprintf(stderr, "Plugin is not supported on this platform.\n");
@@ -620,6 +758,14 @@ bool init_plugin(void *self) {
 }
 
 void uninit_plugin(void *self) {
+#ifdef TARGET_I386
+    free_osiproc(current_proc);
+    current_proc = NULL;
+    if (procs_cache != NULL) g_array_free(procs_cache, true);
+    procs_cache = NULL;
+    if (watched != NULL) g_hash_table_destroy(watched);
+    watched = NULL;
+#endif
     printf("Unloading wintrospection plugin\n");
 }
 
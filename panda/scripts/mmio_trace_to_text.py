@@ -0,0 +1,53 @@
+#!/usr/bin/python2.7
+
+# Convert a binary mmio_trace log into the plugin's text format, one
+# access_type:pc:phys_addr:size:value line per event.
+#
+# usage: mmio_trace_to_text.py <mmio.bin> [out.txt]
+#
+# The layout is mmio_trace_header_t followed by mmio_trace_record_t in
+# panda/plugins/mmio_trace/mmio_trace.h, in the byte order of the host
+# that ran the replay (little-endian for all supported hosts).
+
+from __future__ import print_function
+import struct
+import sys
+
+MAGIC = b'PMIOTRC1'
+VERSION = 1
+HEADER = struct.Struct('<8sII')
+RECORD = struct.Struct('<QQQIc3x')
+BATCH = 4096
+
+def convert(inf, outf):
+    magic, version, addr_bytes = HEADER.unpack(inf.read(HEADER.size))
+    if magic != MAGIC or version != VERSION:
+        raise ValueError("not an mmio_trace v%d log" % VERSION)
+    w = addr_bytes * 2
+    fmt = '%s:0x%0*x:0x%0*x:0x%0*x:0x%0*x\n'
+    while True:
+        buf = inf.read(RECORD.size * BATCH)
+        # a replay that was killed may leave a partial record at the end
+        n = len(buf) // RECORD.size
+        for i in range(n):
+            pc, addr, value, size, access_type = \
+                RECORD.unpack_from(buf, i * RECORD.size)
+            outf.write(fmt % (access_type.decode('ascii'), w, pc, w, addr,
+                              w, size, w, value))
+        if len(buf) < RECORD.size * BATCH:
+            break
+
+def main():
+    if len(sys.argv) not in (2, 3):
+        print("usage: %s <mmio.bin> [out.txt]" % sys.argv[0], file=sys.stderr)
+        return 1
+    with open(sys.argv[1], 'rb') as inf:
+        if len(sys.argv) == 3:
+            with open(sys.argv[2], 'w') as outf:
+                convert(inf, outf)
+        else:
+            convert(inf, sys.stdout)
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,187 @@
+#!/usr/bin/python2.7
+
+# Run a PANDA analysis over a recording in parallel.
+#
+# The replay_slices plugin replays the recording once, takes a fork
+# checkpoint at the start of each of K instruction-count ranges, and replays
+# each range from its checkpoint with the analysis plugins in a separate
+# process. The per-slice pandalogs are then merged into one, in order,
+# keeping only the entries in each slice's own range. Instruction counts are
+# those of the original recording throughout.
+#
+# This only gives correct results for plugins that do not carry state from
+# one part of the replay to the next (e.g. stringsearch), and only their
+# pandalog output is merged.
+#
+# usage: parallel_replay.py [options] <replay> <out.plog> -- <qemu args>
+#
+# e.g.
+#   parallel_replay.py -j 16 --qemu build/i386-softmmu/qemu-system-i386 \
+#       foo foo.plog -- -m 1G -panda stringsearch:name=foo
+
+from __future__ import print_function
+import argparse
+import multiprocessing
+import os
+import re
+import shutil
+import struct
+import subprocess
+import sys
+import tempfile
+import zlib
+
+sys.path.append(os.path.dirname(os.path.realpath(__file__)))
+from plog_reader import PLogReader
+
+PL_CURRENT_VERSION = 2
+PL_HEADER_SIZE = 128
+PL_CHUNK_SIZE = 16384
+
+class PLogWriter:
+    # Writes the same layout as PandaLog::write_dir in plog-cc.cpp.
+    def __init__(self, fn, chunk_size=PL_CHUNK_SIZE):
+        self.f = open(fn, 'wb')
+        self.f.write(b'\0' * PL_HEADER_SIZE)
+        self.chunk_size = chunk_size
+        self.buf = []
+        self.buf_len = 0
+        self.chunk_instr = None
+        self.last_instr = None
+        self.dir = []
+
+    def write(self, msg):
+        # Like the C++ writer, only end a chunk between instructions.
+        if self.buf_len >= self.chunk_size and msg.instr != self.last_instr:
+            self.flush()
+        data = msg.SerializeToString()
+        if not self.buf:
+            self.chunk_instr = msg.instr
+        self.buf.append(struct.pack('<I', len(data)) + data)
+        self.buf_len += 4 + len(data)
+        self.last_instr = msg.instr
+
+    def flush(self):
+        if not self.buf: return
+        self.dir.append((self.chunk_instr, self.f.tell(), len(self.buf)))
+        self.f.write(zlib.compress(b''.join(self.buf), 9))
+        self.buf = []
+        self.buf_len = 0
+
+    def close(self):
+        self.flush()
+        dir_pos = self.f.tell()
+        self.f.write(struct.pack('<I', len(self.dir)))
+        for entry in self.dir:
+            self.f.write(struct.pack('<QQQ', *entry))
+        self.f.seek(0)
+        self.f.write(struct.pack('<IIQII', PL_CURRENT_VERSION, 0, dir_pos,
+                                 self.chunk_size, 0))
+        self.f.close()
+
+def split_panda_args(qemu_args):
+    # Returns the machine arguments, the analysis plugins, and their
+    # arguments as -panda-arg values. replay_slices loads the plugins in
+    # each slice, so they must not be loaded by -panda.
+    machine_args = []
+    plugins = []
+    plugin_args = []
+    i = 0
+    while i < len(qemu_args):
+        arg = qemu_args[i]
+        if arg == '-panda' and i + 1 < len(qemu_args):
+            for spec in qemu_args[i + 1].split(';'):
+                name, _, opts = spec.partition(':')
+                if not name: continue
+                plugins.append(name)
+                plugin_args += ['%s:%s' % (name, o)
+                                for o in opts.split(',') if o]
+            i += 2
+        elif arg == '-panda-arg' and i + 1 < len(qemu_args):
+            plugin_args.append(qemu_args[i + 1])
+            i += 2
+        elif arg == '-pandalog':
+            # Each slice writes its own.
+            i += 2
+        else:
+            machine_args.append(arg)
+            i += 1
+    return machine_args, plugins, plugin_args
+
+def main():
+    ap = argparse.ArgumentParser(
+        description='Replay slices of a recording in parallel and merge '
+                    'their pandalogs.')
+    ap.add_argument('replay', help='recording base name')
+    ap.add_argument('plog', help='merged pandalog to write')
+    ap.add_argument('qemu_args', nargs=argparse.REMAINDER,
+                    help='-- followed by machine and -panda arguments')
+    ap.add_argument('-j', '--jobs', type=int,
+                    default=multiprocessing.cpu_count(),
+                    help='processes to run at once (default: number of cpus)')
+    ap.add_argument('-k', '--slices', type=int, default=None,
+                    help='number of slices (default: jobs)')
+    ap.add_argument('--qemu', default='qemu-system-i386',
+                    help='PANDA binary for the recording\'s architecture')
+    ap.add_argument('--workdir', default=None,
+                    help='where to put slice pandalogs and output (kept '
+                         'afterwards)')
+    args = ap.parse_args()
+
+    qemu_args = args.qemu_args
+    if qemu_args and qemu_args[0] == '--':
+        qemu_args = qemu_args[1:]
+    nslices = args.slices or args.jobs
+    machine_args, plugins, plugin_args = split_panda_args(qemu_args)
+
+    workdir = args.workdir or tempfile.mkdtemp(prefix='panda-slices-')
+    if not os.path.isdir(workdir):
+        os.makedirs(workdir)
+    prefix = os.path.join(workdir, 'slice')
+
+    cmd = [args.qemu] + machine_args + [
+        '-display', 'none', '-replay', os.path.abspath(args.replay),
+        '-panda', 'replay_slices:n=%d,jobs=%d,plugins=%s,plog=%s'
+                  % (nslices, args.jobs, '+'.join(plugins), prefix)]
+    for a in plugin_args:
+        cmd += ['-panda-arg', a]
+    log = os.path.join(workdir, 'replay.out')
+    print("Replaying %s in %d slices, %d at a time..."
+          % (args.replay, nslices, args.jobs))
+    with open(log, 'w') as out:
+        # Returns once every slice has finished.
+        code = subprocess.call(cmd, stdout=out, stderr=subprocess.STDOUT)
+    output = open(log).read()
+
+    ranges = {}
+    for m in re.finditer(r'replay_slices: slice (\d+) \[(\d+), (\d+)\)',
+                         output):
+        ranges[int(m.group(1))] = (int(m.group(2)), int(m.group(3)))
+    done = set(int(m.group(1)) for m in
+               re.finditer(r'replay_slices: slice (\d+) done', output))
+    missing = [n for n in range(nslices) if n not in ranges or n not in done]
+    if code or missing:
+        print("slices %s failed, see %s" % (missing, log), file=sys.stderr)
+        return 1
+
+    # Merge. Slices end on the block their successor starts at, so this
+    # only drops entries if a plugin logged past the end of its slice.
+    out = PLogWriter(args.plog)
+    for n in range(nslices):
+        start, end = ranges[n]
+        plog = '%s%d.plog' % (prefix, n)
+        if not os.path.exists(plog): continue
+        with PLogReader(plog) as plr:
+            for msg in plr:
+                if msg.instr < start or (end and msg.instr >= end):
+                    continue
+                out.write(msg)
+    out.close()
+    print("Wrote %s" % args.plog)
+
+    if args.workdir is None:
+        shutil.rmtree(workdir)
+    return 0
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -30,10 +30,15 @@ for dc in itertools.product(top_dirs, build_dirs, arch_dirs):
 
 assert 'plog_pb2' in sys.modules, "Couldn't load module plog_pb2. Searched paths:\n\t%s" % "\n\t".join(searched_paths)
 
+PL_CODEC_ZLIB = 0
+PL_CODEC_NONE = 1
+
 class PLogReader:
     def __init__(self, fn):
         self.f = open(fn)
-        self.version, _, self.dir_pos, _, self.chunk_gsize = struct.unpack('<IIQII', self.f.read(24))
+        self.version, _, self.dir_pos, self.chunk_gsize, codec = struct.unpack('<IIQII', self.f.read(24))
+        # version 3 added the chunk codec; older logs are always zlib
+        self.compressed = self.version < 3 or codec == PL_CODEC_ZLIB
 
         self.f.seek(self.dir_pos)
         self.nchunks, = struct.unpack('<I', self.f.read(4)) # number of chunks
@@ -65,13 +70,14 @@ class PLogReader:
                 nxt = struct.unpack_from('<QQQ', self.chunks, 24*(self.chunk_idx+1))
                 zchunk_size = nxt[1] - cur[1]
             else:
-                # setting the compressed chunk size to -1 will
-                # result in reading the remaining of the file
-                zchunk_size = -1
+                # the last chunk ends where the directory starts
+                zchunk_size = self.dir_pos - cur[1]
 
             # read and decompress chunk data
             self.f.seek(cur[1])
-            self.chunk_data = zlib.decompress(self.f.read(zchunk_size), 15, self.chunk_gsize)
+            self.chunk_data = self.f.read(zchunk_size)
+            if self.compressed:
+                self.chunk_data = zlib.decompress(self.chunk_data, 15, self.chunk_gsize)
             self.chunk_size = len(self.chunk_data)
             self.chunk_data_idx = 0
 
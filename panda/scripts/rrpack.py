@@ -40,7 +40,7 @@ outf.write(RRPACK_MAGIC)
 outf.write(struct.pack("<Q", num_guest_insns))
 outf.write("\0" * 16) # Placeholder for checksum
 outf.flush()
-subprocess.check_call(['tar', 'cJf', '-', base + '-rr-snp', base + '-rr-nondet.log'], stdout=outf)
+subprocess.check_call(['tar', 'cSJf', '-', base + '-rr-snp', base + '-rr-nondet.log'], stdout=outf)
 outf.close()
 
 print "Calculating checksum...",
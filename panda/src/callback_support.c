@@ -13,32 +13,26 @@
 void panda_callbacks_hd_transfer(CPUState *cpu, Hd_transfer_type type, uint64_t src_addr, uint64_t dest_addr, uint32_t num_bytes)
 {
     if (rr_mode == RR_REPLAY) {
-        panda_cb_list *plist;
-        for (plist = panda_cbs[PANDA_CB_REPLAY_HD_TRANSFER];
-             plist != NULL;
-             plist = panda_cb_list_next(plist)) {
-                 plist->entry.replay_hd_transfer(cpu, type, src_addr, dest_addr, num_bytes);
+        panda_cb_table *t = &panda_cb_tables[PANDA_CB_REPLAY_HD_TRANSFER];
+        for (int i = 0; i < t->n; i++) {
+            t->cbs[i].replay_hd_transfer(cpu, type, src_addr, dest_addr, num_bytes);
         }
     }
 }
 
 void panda_callbacks_handle_packet(CPUState *cpu, uint8_t *buf, size_t size, uint8_t direction, uint64_t old_buf_addr) {
     if (rr_mode == RR_REPLAY) {
-        panda_cb_list *plist;
-        for (plist = panda_cbs[PANDA_CB_REPLAY_HANDLE_PACKET];
-             plist != NULL;
-             plist = panda_cb_list_next(plist)) {
-                 plist->entry.replay_handle_packet(cpu, buf, size, direction, old_buf_addr);
+        panda_cb_table *t = &panda_cb_tables[PANDA_CB_REPLAY_HANDLE_PACKET];
+        for (int i = 0; i < t->n; i++) {
+            t->cbs[i].replay_handle_packet(cpu, buf, size, direction, old_buf_addr);
         }
     }
 }
 void panda_callbacks_net_transfer(CPUState *cpu, Net_transfer_type type, uint64_t src_addr, uint64_t dst_addr, uint32_t num_bytes) {
     if (rr_mode == RR_REPLAY) {
-        panda_cb_list *plist;
-        for (plist = panda_cbs[PANDA_CB_REPLAY_NET_TRANSFER];
-             plist != NULL;
-             plist = panda_cb_list_next(plist)) {
-                 plist->entry.replay_net_transfer(cpu, type, src_addr, dst_addr, num_bytes);
+        panda_cb_table *t = &panda_cb_tables[PANDA_CB_REPLAY_NET_TRANSFER];
+        for (int i = 0; i < t->n; i++) {
+            t->cbs[i].replay_net_transfer(cpu, type, src_addr, dst_addr, num_bytes);
         }
     }
 }
@@ -46,57 +40,51 @@ void panda_callbacks_net_transfer(CPUState *cpu, Net_transfer_type type, uint64_
 // These are used in exec.c
 void panda_callbacks_before_dma(CPUState *cpu, hwaddr addr1, const uint8_t *buf, hwaddr l, int is_write) {
     if (rr_mode == RR_REPLAY) {
-        panda_cb_list *plist;
-        for (plist = panda_cbs[PANDA_CB_REPLAY_BEFORE_DMA];
-             plist != NULL; plist = panda_cb_list_next(plist)) {
-            plist->entry.replay_before_dma(cpu, is_write, (uint8_t *) buf, (uint64_t) addr1, l);
+        panda_cb_table *t = &panda_cb_tables[PANDA_CB_REPLAY_BEFORE_DMA];
+        for (int i = 0; i < t->n; i++) {
+            t->cbs[i].replay_before_dma(cpu, is_write, (uint8_t *) buf, (uint64_t) addr1, l);
         }
     }
 }
 
 void panda_callbacks_after_dma(CPUState *cpu, hwaddr addr1, const uint8_t *buf, hwaddr l, int is_write) {
     if (rr_mode == RR_REPLAY) {
-        panda_cb_list *plist;
-       for (plist = panda_cbs[PANDA_CB_REPLAY_AFTER_DMA];
-            plist != NULL; plist = panda_cb_list_next(plist)) {
-            plist->entry.replay_after_dma(cpu, is_write, (uint8_t *) buf, (uint64_t) addr1, l);
+        panda_cb_table *t = &panda_cb_tables[PANDA_CB_REPLAY_AFTER_DMA];
+        for (int i = 0; i < t->n; i++) {
+            t->cbs[i].replay_after_dma(cpu, is_write, (uint8_t *) buf, (uint64_t) addr1, l);
         }
     }
 }
 
 // These are used in cpu-exec.c
 void panda_callbacks_before_block_exec(CPUState *cpu, TranslationBlock *tb) {
-    panda_cb_list *plist;
-    for (plist = panda_cbs[PANDA_CB_BEFORE_BLOCK_EXEC];
-         plist != NULL; plist = panda_cb_list_next(plist)) {
-        plist->entry.before_block_exec(cpu, tb);
+    panda_cb_table *t = &panda_cb_tables[PANDA_CB_BEFORE_BLOCK_EXEC];
+    for (int i = 0; i < t->n; i++) {
+        t->cbs[i].before_block_exec(cpu, tb);
     }
 }
 
 
 void panda_callbacks_after_block_exec(CPUState *cpu, TranslationBlock *tb, uint8_t exitCode) {
-    panda_cb_list *plist;
-    for (plist = panda_cbs[PANDA_CB_AFTER_BLOCK_EXEC];
-         plist != NULL; plist = panda_cb_list_next(plist)) {
-        plist->entry.after_block_exec(cpu, tb, exitCode);
+    panda_cb_table *t = &panda_cb_tables[PANDA_CB_AFTER_BLOCK_EXEC];
+    for (int i = 0; i < t->n; i++) {
+        t->cbs[i].after_block_exec(cpu, tb, exitCode);
     }
 }
 
 
 void panda_callbacks_before_block_translate(CPUState *cpu, target_ulong pc) {
-    panda_cb_list *plist;
-    for (plist = panda_cbs[PANDA_CB_BEFORE_BLOCK_TRANSLATE];
-         plist != NULL; plist = panda_cb_list_next(plist)) {
-        plist->entry.before_block_translate(cpu, pc);
+    panda_cb_table *t = &panda_cb_tables[PANDA_CB_BEFORE_BLOCK_TRANSLATE];
+    for (int i = 0; i < t->n; i++) {
+        t->cbs[i].before_block_translate(cpu, pc);
     }
 }
 
 
 void panda_callbacks_after_block_translate(CPUState *cpu, TranslationBlock *tb) {
-    panda_cb_list *plist;
-    for (plist = panda_cbs[PANDA_CB_AFTER_BLOCK_TRANSLATE];
-         plist != NULL; plist = panda_cb_list_next(plist)) {
-        plist->entry.after_block_translate(cpu, tb);
+    panda_cb_table *t = &panda_cb_tables[PANDA_CB_AFTER_BLOCK_TRANSLATE];
+    for (int i = 0; i < t->n; i++) {
+        t->cbs[i].after_block_translate(cpu, tb);
     }
 }
 
@@ -118,53 +106,56 @@ void panda_before_find_fast(void) {
 
 
 bool panda_callbacks_after_find_fast(CPUState *cpu, TranslationBlock *tb, bool bb_invalidate_done, bool *invalidate) {
-    panda_cb_list *plist;
     if (!bb_invalidate_done) {
-        for(plist = panda_cbs[PANDA_CB_BEFORE_BLOCK_EXEC_INVALIDATE_OPT];
-            plist != NULL; plist = panda_cb_list_next(plist)) {
+        panda_cb_table *t = &panda_cb_tables[PANDA_CB_BEFORE_BLOCK_EXEC_INVALIDATE_OPT];
+        for (int i = 0; i < t->n; i++) {
             *invalidate |=
-                plist->entry.before_block_exec_invalidate_opt(cpu, tb);
+                t->cbs[i].before_block_exec_invalidate_opt(cpu, tb);
         }
         return true;
     }
     return false;
 }
 
+bool panda_block_callbacks_registered(void) {
+    return panda_has_callbacks(PANDA_CB_BEFORE_BLOCK_EXEC)
+        || panda_has_callbacks(PANDA_CB_AFTER_BLOCK_EXEC)
+        || panda_has_callbacks(PANDA_CB_BEFORE_BLOCK_EXEC_INVALIDATE_OPT);
+}
+
 void panda_callbacks_after_cpu_exec_enter(CPUState *cpu) {
-    panda_cb_list *plist;
-    for (plist = panda_cbs[PANDA_CB_AFTER_CPU_EXEC_ENTER];
-         plist != NULL; plist = panda_cb_list_next(plist)) {
-        plist->entry.after_cpu_exec_enter(cpu);
+    panda_cb_table *t = &panda_cb_tables[PANDA_CB_AFTER_CPU_EXEC_ENTER];
+    for (int i = 0; i < t->n; i++) {
+        t->cbs[i].after_cpu_exec_enter(cpu);
     }
 }
 
 void panda_callbacks_before_cpu_exec_exit(CPUState *cpu, bool ranBlock) {
-    panda_cb_list *plist;
-    for (plist = panda_cbs[PANDA_CB_BEFORE_CPU_EXEC_EXIT];
-         plist != NULL; plist = panda_cb_list_next(plist)) {
-        plist->entry.before_cpu_exec_exit(cpu, ranBlock);
+    panda_cb_table *t = &panda_cb_tables[PANDA_CB_BEFORE_CPU_EXEC_EXIT];
+    for (int i = 0; i < t->n; i++) {
+        t->cbs[i].before_cpu_exec_exit(cpu, ranBlock);
     }
 }
 
 // These are used in target-i386/translate.c
+// The translate callbacks always run, but the front end is only told to emit
+// the exec helper call if some plugin is actually listening for it.
 bool panda_callbacks_insn_translate(CPUState *env, target_ulong pc) {
-    panda_cb_list *plist;
     bool panda_exec_cb = false;
-    for(plist = panda_cbs[PANDA_CB_INSN_TRANSLATE]; plist != NULL;
-        plist = panda_cb_list_next(plist)) {
-        panda_exec_cb |= plist->entry.insn_translate(env, pc);
+    panda_cb_table *t = &panda_cb_tables[PANDA_CB_INSN_TRANSLATE];
+    for (int i = 0; i < t->n; i++) {
+        panda_exec_cb |= t->cbs[i].insn_translate(env, pc);
     }
-    return panda_exec_cb;
+    return panda_exec_cb && panda_has_callbacks(PANDA_CB_INSN_EXEC);
 }
 
 bool panda_callbacks_after_insn_translate(CPUState *env, target_ulong pc) {
-    panda_cb_list *plist;
     bool panda_exec_cb = false;
-    for(plist = panda_cbs[PANDA_CB_AFTER_INSN_TRANSLATE]; plist != NULL;
-        plist = panda_cb_list_next(plist)) {
-        panda_exec_cb |= plist->entry.after_insn_translate(env, pc);
+    panda_cb_table *t = &panda_cb_tables[PANDA_CB_AFTER_INSN_TRANSLATE];
+    for (int i = 0; i < t->n; i++) {
+        panda_exec_cb |= t->cbs[i].after_insn_translate(env, pc);
     }
-    return panda_exec_cb;
+    return panda_exec_cb && panda_has_callbacks(PANDA_CB_AFTER_INSN_EXEC);
 }
 
 static inline hwaddr get_paddr(CPUState *cpu, target_ulong addr, void *ram_ptr) {
@@ -187,18 +178,17 @@ static inline hwaddr get_paddr(CPUState *cpu, target_ulong addr, void *ram_ptr)
 void panda_callbacks_before_mem_read(CPUState *env, target_ulong pc,
                                      target_ulong addr, uint32_t data_size,
                                      void *ram_ptr) {
-    panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_VIRT_MEM_BEFORE_READ]; plist != NULL;
-        plist = panda_cb_list_next(plist)) {
-        plist->entry.virt_mem_before_read(env, env->panda_guest_pc, addr,
-                                          data_size);
+    panda_cb_table *t = &panda_cb_tables[PANDA_CB_VIRT_MEM_BEFORE_READ];
+    for (int i = 0; i < t->n; i++) {
+        t->cbs[i].virt_mem_before_read(env, env->panda_guest_pc, addr,
+                                       data_size);
     }
-    if (panda_cbs[PANDA_CB_PHYS_MEM_BEFORE_READ]) {
+    t = &panda_cb_tables[PANDA_CB_PHYS_MEM_BEFORE_READ];
+    if (t->n > 0) {
         hwaddr paddr = get_paddr(env, addr, ram_ptr);
-        for(plist = panda_cbs[PANDA_CB_PHYS_MEM_BEFORE_READ]; plist != NULL;
-            plist = panda_cb_list_next(plist)) {
-            plist->entry.phys_mem_before_read(env, env->panda_guest_pc, paddr,
-                                              data_size);
+        for (int i = 0; i < t->n; i++) {
+            t->cbs[i].phys_mem_before_read(env, env->panda_guest_pc, paddr,
+                                           data_size);
         }
     }
 }
@@ -207,18 +197,17 @@ void panda_callbacks_before_mem_read(CPUState *env, target_ulong pc,
 void panda_callbacks_after_mem_read(CPUState *env, target_ulong pc,
                                     target_ulong addr, uint32_t data_size,
                                     uint64_t result, void *ram_ptr) {
-    panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_VIRT_MEM_AFTER_READ]; plist != NULL;
-        plist = panda_cb_list_next(plist)) {
-        plist->entry.virt_mem_after_read(env, env->panda_guest_pc, addr,
-                                         data_size, &result);
+    panda_cb_table *t = &panda_cb_tables[PANDA_CB_VIRT_MEM_AFTER_READ];
+    for (int i = 0; i < t->n; i++) {
+        t->cbs[i].virt_mem_after_read(env, env->panda_guest_pc, addr,
+                                      data_size, &result);
     }
-    if (panda_cbs[PANDA_CB_PHYS_MEM_AFTER_READ]) {
+    t = &panda_cb_tables[PANDA_CB_PHYS_MEM_AFTER_READ];
+    if (t->n > 0) {
         hwaddr paddr = get_paddr(env, addr, ram_ptr);
-        for(plist = panda_cbs[PANDA_CB_PHYS_MEM_AFTER_READ]; plist != NULL;
-            plist = panda_cb_list_next(plist)) {
-            plist->entry.phys_mem_after_read(env, env->panda_guest_pc, paddr,
-                                             data_size, &result);
+        for (int i = 0; i < t->n; i++) {
+            t->cbs[i].phys_mem_after_read(env, env->panda_guest_pc, paddr,
+                                          data_size, &result);
         }
     }
 }
@@ -227,18 +216,17 @@ void panda_callbacks_after_mem_read(CPUState *env, target_ulong pc,
 void panda_callbacks_before_mem_write(CPUState *env, target_ulong pc,
                                       target_ulong addr, uint32_t data_size,
                                       uint64_t val, void *ram_ptr) {
-    panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_VIRT_MEM_BEFORE_WRITE]; plist != NULL;
-        plist = panda_cb_list_next(plist)) {
-        plist->entry.virt_mem_before_write(env, env->panda_guest_pc, addr,
-                                           data_size, &val);
+    panda_cb_table *t = &panda_cb_tables[PANDA_CB_VIRT_MEM_BEFORE_WRITE];
+    for (int i = 0; i < t->n; i++) {
+        t->cbs[i].virt_mem_before_write(env, env->panda_guest_pc, addr,
+                                        data_size, &val);
     }
-    if (panda_cbs[PANDA_CB_PHYS_MEM_BEFORE_WRITE]) {
+    t = &panda_cb_tables[PANDA_CB_PHYS_MEM_BEFORE_WRITE];
+    if (t->n > 0) {
         hwaddr paddr = get_paddr(env, addr, ram_ptr);
-        for(plist = panda_cbs[PANDA_CB_PHYS_MEM_BEFORE_WRITE]; plist != NULL;
-            plist = panda_cb_list_next(plist)) {
-            plist->entry.phys_mem_before_write(env, env->panda_guest_pc, paddr,
-                                               data_size, &val);
+        for (int i = 0; i < t->n; i++) {
+            t->cbs[i].phys_mem_before_write(env, env->panda_guest_pc, paddr,
+                                            data_size, &val);
         }
     }
 }
@@ -247,18 +235,107 @@ void panda_callbacks_before_mem_write(CPUState *env, target_ulong pc,
 void panda_callbacks_after_mem_write(CPUState *env, target_ulong pc,
                                      target_ulong addr, uint32_t data_size,
                                      uint64_t val, void *ram_ptr) {
-    panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_VIRT_MEM_AFTER_WRITE]; plist != NULL;
-        plist = panda_cb_list_next(plist)) {
-        plist->entry.virt_mem_after_write(env, env->panda_guest_pc, addr,
-                                          data_size, &val);
+    panda_cb_table *t = &panda_cb_tables[PANDA_CB_VIRT_MEM_AFTER_WRITE];
+    for (int i = 0; i < t->n; i++) {
+        t->cbs[i].virt_mem_after_write(env, env->panda_guest_pc, addr,
+                                       data_size, &val);
     }
-    if (panda_cbs[PANDA_CB_PHYS_MEM_AFTER_WRITE]) {
+    t = &panda_cb_tables[PANDA_CB_PHYS_MEM_AFTER_WRITE];
+    if (t->n > 0) {
         hwaddr paddr = get_paddr(env, addr, ram_ptr);
-        for(plist = panda_cbs[PANDA_CB_PHYS_MEM_AFTER_WRITE]; plist != NULL;
-            plist = panda_cb_list_next(plist)) {
-            plist->entry.phys_mem_after_write(env, env->panda_guest_pc, paddr,
-                                              data_size, &val);
+        for (int i = 0; i < t->n; i++) {
+            t->cbs[i].phys_mem_after_write(env, env->panda_guest_pc, paddr,
+                                           data_size, &val);
+        }
+    }
+}
+
+// These are used for range-limited memory callbacks.
+static inline bool panda_mem_range_is_write(panda_cb_type type) {
+    return type == PANDA_CB_VIRT_MEM_BEFORE_WRITE || type == PANDA_CB_PHYS_MEM_BEFORE_WRITE
+        || type == PANDA_CB_VIRT_MEM_AFTER_WRITE || type == PANDA_CB_PHYS_MEM_AFTER_WRITE;
+}
+
+static inline bool panda_mem_range_is_phys(panda_cb_type type) {
+    return type == PANDA_CB_PHYS_MEM_BEFORE_READ || type == PANDA_CB_PHYS_MEM_BEFORE_WRITE
+        || type == PANDA_CB_PHYS_MEM_AFTER_READ || type == PANDA_CB_PHYS_MEM_AFTER_WRITE;
+}
+
+// cputlb.c: does the page at vaddr/paddr hold part of a watched range?
+void panda_mem_watch_page(CPUState *cpu, target_ulong vaddr, hwaddr paddr,
+                          bool *read, bool *write) {
+    *read = *write = false;
+    if (panda_num_mem_ranges == 0) return;
+
+    target_ulong asid = panda_current_asid(cpu);
+    vaddr &= TARGET_PAGE_MASK;
+    paddr &= TARGET_PAGE_MASK;
+    for (int i = 0; i < panda_num_mem_ranges; i++) {
+        panda_mem_range *r = &panda_mem_ranges[i];
+        if (!r->in_use || (r->asid && r->asid != asid)) continue;
+        uint64_t page = panda_mem_range_is_phys(r->type) ? paddr : vaddr;
+        if (page < r->end && r->start < page + TARGET_PAGE_SIZE) {
+            if (panda_mem_range_is_write(r->type)) {
+                *write = true;
+            } else {
+                *read = true;
+            }
+        }
+    }
+}
+
+// softmmu_template.h: an access to a page marked by panda_mem_watch_page.
+void panda_callbacks_mem_watch(CPUState *cpu, bool is_write, bool after,
+                               target_ulong addr, uint32_t data_size,
+                               uint64_t val, void *ram_ptr) {
+    target_ulong asid = panda_current_asid(cpu);
+    bool have_paddr = false;
+    hwaddr paddr = 0;
+    for (int i = 0; i < panda_num_mem_ranges; i++) {
+        // Callbacks may (un)register ranges, so don't hold on to entries.
+        panda_mem_range r = panda_mem_ranges[i];
+        if (!r.in_use || panda_mem_range_is_write(r.type) != is_write
+                || (r.type >= PANDA_CB_VIRT_MEM_AFTER_READ) != after
+                || (r.asid && r.asid != asid)) {
+            continue;
+        }
+        uint64_t a = addr;
+        if (panda_mem_range_is_phys(r.type)) {
+            if (!have_paddr) {
+                paddr = get_paddr(cpu, addr, ram_ptr);
+                have_paddr = true;
+            }
+            a = paddr;
+        }
+        if (a >= r.end || r.start >= a + data_size) continue;
+
+        switch (r.type) {
+            case PANDA_CB_VIRT_MEM_BEFORE_READ:
+                r.cb.virt_mem_before_read(cpu, cpu->panda_guest_pc, addr, data_size);
+                break;
+            case PANDA_CB_VIRT_MEM_BEFORE_WRITE:
+                r.cb.virt_mem_before_write(cpu, cpu->panda_guest_pc, addr, data_size, &val);
+                break;
+            case PANDA_CB_PHYS_MEM_BEFORE_READ:
+                r.cb.phys_mem_before_read(cpu, cpu->panda_guest_pc, paddr, data_size);
+                break;
+            case PANDA_CB_PHYS_MEM_BEFORE_WRITE:
+                r.cb.phys_mem_before_write(cpu, cpu->panda_guest_pc, paddr, data_size, &val);
+                break;
+            case PANDA_CB_VIRT_MEM_AFTER_READ:
+                r.cb.virt_mem_after_read(cpu, cpu->panda_guest_pc, addr, data_size, &val);
+                break;
+            case PANDA_CB_VIRT_MEM_AFTER_WRITE:
+                r.cb.virt_mem_after_write(cpu, cpu->panda_guest_pc, addr, data_size, &val);
+                break;
+            case PANDA_CB_PHYS_MEM_AFTER_READ:
+                r.cb.phys_mem_after_read(cpu, cpu->panda_guest_pc, paddr, data_size, &val);
+                break;
+            case PANDA_CB_PHYS_MEM_AFTER_WRITE:
+                r.cb.phys_mem_after_write(cpu, cpu->panda_guest_pc, paddr, data_size, &val);
+                break;
+            default:
+                break;
         }
     }
 }
@@ -266,62 +343,57 @@ void panda_callbacks_after_mem_write(CPUState *env, target_ulong pc,
 // These are used in cputlb.c
 void panda_callbacks_after_mmio_read(CPUState *env, target_ulong addr, int size, uint64_t val) {
 
-    panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_MMIO_AFTER_READ]; plist != NULL;
-        plist = panda_cb_list_next(plist)) {
-        plist->entry.after_mmio_read(env, addr, size, val);
+    panda_cb_table *t = &panda_cb_tables[PANDA_CB_MMIO_AFTER_READ];
+    for (int i = 0; i < t->n; i++) {
+        t->cbs[i].after_mmio_read(env, addr, size, val);
     }
 }
 
 void panda_callbacks_after_mmio_write(CPUState *env, target_ulong addr, int size, uint64_t val) {
 
-    panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_MMIO_AFTER_WRITE]; plist != NULL;
-        plist = panda_cb_list_next(plist)) {
-        plist->entry.after_mmio_write(env, addr, size, val);
+    panda_cb_table *t = &panda_cb_tables[PANDA_CB_MMIO_AFTER_WRITE];
+    for (int i = 0; i < t->n; i++) {
+        t->cbs[i].after_mmio_write(env, addr, size, val);
     }
 }
 
 // vl.c
 void panda_callbacks_after_machine_init(void) {
-    panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_AFTER_MACHINE_INIT]; plist != NULL;
-        plist = panda_cb_list_next(plist)) {
-        plist->entry.after_machine_init(first_cpu);
+    panda_cb_table *t = &panda_cb_tables[PANDA_CB_AFTER_MACHINE_INIT];
+    for (int i = 0; i < t->n; i++) {
+        t->cbs[i].after_machine_init(first_cpu);
     }
 }
 
 void panda_callbacks_top_loop(void) {
-    panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_TOP_LOOP]; plist != NULL;
-        plist = panda_cb_list_next(plist)) {
-        plist->entry.top_loop(first_cpu);
+    panda_cb_table *t = &panda_cb_tables[PANDA_CB_TOP_LOOP];
+    for (int i = 0; i < t->n; i++) {
+        t->cbs[i].top_loop(first_cpu);
     }
 }
 
 
 // target-i386/misc_helpers.c
 void panda_callbacks_cpuid(CPUState *env) {
-    panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_GUEST_HYPERCALL]; plist != NULL; plist = panda_cb_list_next(plist)) {
-        plist->entry.guest_hypercall(env);
+    panda_cb_table *t = &panda_cb_tables[PANDA_CB_GUEST_HYPERCALL];
+    for (int i = 0; i < t->n; i++) {
+        t->cbs[i].guest_hypercall(env);
     }
 }
 
 
 void panda_callbacks_cpu_restore_state(CPUState *env, TranslationBlock *tb) {
-    panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_CPU_RESTORE_STATE]; plist != NULL;
-        plist = panda_cb_list_next(plist)) {
-        plist->entry.cb_cpu_restore_state(env, tb);
+    panda_cb_table *t = &panda_cb_tables[PANDA_CB_CPU_RESTORE_STATE];
+    for (int i = 0; i < t->n; i++) {
+        t->cbs[i].cb_cpu_restore_state(env, tb);
     }
 }
 
 
 void panda_callbacks_asid_changed(CPUState *env, target_ulong old_asid, target_ulong new_asid) {
-    panda_cb_list *plist;
-    for(plist = panda_cbs[PANDA_CB_ASID_CHANGED]; plist != NULL; plist = panda_cb_list_next(plist)) {
-        plist->entry.asid_changed(env, old_asid, new_asid);
+    panda_cb_table *t = &panda_cb_tables[PANDA_CB_ASID_CHANGED];
+    for (int i = 0; i < t->n; i++) {
+        t->cbs[i].asid_changed(env, old_asid, new_asid);
     }
 }
 
@@ -329,10 +401,9 @@ void panda_callbacks_serial_receive(CPUState *cpu, uint64_t fifo_addr,
                                     uint8_t value)
 {
     if (rr_mode == RR_REPLAY) {
-        panda_cb_list *plist;
-        for (plist = panda_cbs[PANDA_CB_REPLAY_SERIAL_RECEIVE]; plist != NULL;
-             plist = panda_cb_list_next(plist)) {
-            plist->entry.replay_serial_receive(cpu, fifo_addr, value);
+        panda_cb_table *t = &panda_cb_tables[PANDA_CB_REPLAY_SERIAL_RECEIVE];
+        for (int i = 0; i < t->n; i++) {
+            t->cbs[i].replay_serial_receive(cpu, fifo_addr, value);
         }
     }
 }
@@ -341,10 +412,9 @@ void panda_callbacks_serial_read(CPUState *cpu, uint64_t fifo_addr,
                                  uint32_t port_addr, uint8_t value)
 {
     if (rr_mode == RR_REPLAY) {
-        panda_cb_list *plist;
-        for (plist = panda_cbs[PANDA_CB_REPLAY_SERIAL_READ]; plist != NULL;
-             plist = panda_cb_list_next(plist)) {
-            plist->entry.replay_serial_read(cpu, fifo_addr, port_addr, value);
+        panda_cb_table *t = &panda_cb_tables[PANDA_CB_REPLAY_SERIAL_READ];
+        for (int i = 0; i < t->n; i++) {
+            t->cbs[i].replay_serial_read(cpu, fifo_addr, port_addr, value);
         }
     }
 }
@@ -353,10 +423,9 @@ void panda_callbacks_serial_send(CPUState *cpu, uint64_t fifo_addr,
                                  uint8_t value)
 {
     if (rr_mode == RR_REPLAY) {
-        panda_cb_list *plist;
-        for (plist = panda_cbs[PANDA_CB_REPLAY_SERIAL_SEND]; plist != NULL;
-             plist = panda_cb_list_next(plist)) {
-            plist->entry.replay_serial_send(cpu, fifo_addr, value);
+        panda_cb_table *t = &panda_cb_tables[PANDA_CB_REPLAY_SERIAL_SEND];
+        for (int i = 0; i < t->n; i++) {
+            t->cbs[i].replay_serial_send(cpu, fifo_addr, value);
         }
     }
 }
@@ -365,10 +434,9 @@ void panda_callbacks_serial_write(CPUState *cpu, uint64_t fifo_addr,
                                   uint32_t port_addr, uint8_t value)
 {
     if (rr_mode == RR_REPLAY) {
-        panda_cb_list *plist;
-        for (plist = panda_cbs[PANDA_CB_REPLAY_SERIAL_WRITE]; plist != NULL;
-             plist = panda_cb_list_next(plist)) {
-            plist->entry.replay_serial_write(cpu, fifo_addr, port_addr, value);
+        panda_cb_table *t = &panda_cb_tables[PANDA_CB_REPLAY_SERIAL_WRITE];
+        for (int i = 0; i < t->n; i++) {
+            t->cbs[i].replay_serial_write(cpu, fifo_addr, port_addr, value);
         }
     }
 }
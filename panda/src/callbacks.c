@@ -43,6 +43,11 @@ WARNING: This is all gloriously thread-unsafe!!!
 
 // Array of pointers to PANDA callback lists, one per callback type
 panda_cb_list *panda_cbs[PANDA_CB_LAST];
+panda_cb_table panda_cb_tables[PANDA_CB_LAST];
+
+// Range-limited memory callbacks. Slots are reused, so ids stay valid.
+panda_mem_range *panda_mem_ranges;
+int panda_num_mem_ranges = 0;
 
 // Storage for command line options
 const gchar *panda_argv[MAX_PANDA_PLUGIN_ARGS];
@@ -229,6 +234,47 @@ void *panda_get_plugin_by_name(const char *plugin_name) {
     return NULL;
 }
 
+/*
+ * Recompiles the dispatch table for one callback type from its list.
+ * Callbacks may register, enable or disable others while the table is being
+ * walked, which is why the dispatch loops index it rather than holding on to
+ * a pointer into it.
+ */
+static void panda_cb_table_rebuild(panda_cb_type type) {
+    panda_cb_table *t = &panda_cb_tables[type];
+    bool had_cbs = t->n > 0;
+    int n = 0;
+    for (panda_cb_list *plist = panda_cbs[type]; plist != NULL; plist = plist->next) {
+        if (plist->enabled) n++;
+    }
+    if (n > t->cap) {
+        t->cap = MAX(n, 2 * t->cap);
+        t->cbs = g_renew(panda_cb, t->cbs, t->cap);
+    }
+    n = 0;
+    for (panda_cb_list *plist = panda_cbs[type]; plist != NULL; plist = plist->next) {
+        if (plist->enabled) t->cbs[n++] = plist->entry;
+    }
+    t->n = n;
+
+    // Translated code depends on whether these have any callbacks: the front
+    // ends only emit insn exec helpers for someone listening, and replay only
+    // chains TBs while no block-level callbacks are enabled (see tb_find).
+    if (had_cbs != (n > 0)) {
+        switch (type) {
+            case PANDA_CB_INSN_EXEC:
+            case PANDA_CB_AFTER_INSN_EXEC:
+            case PANDA_CB_BEFORE_BLOCK_EXEC:
+            case PANDA_CB_AFTER_BLOCK_EXEC:
+            case PANDA_CB_BEFORE_BLOCK_EXEC_INVALIDATE_OPT:
+                panda_do_flush_tb();
+                break;
+            default:
+                break;
+        }
+    }
+}
+
 /**
  * @brief Adds callback to the tail of the callback list and enables it.
  *
@@ -258,6 +304,7 @@ void panda_register_callback(void *plugin, panda_cb_type type, panda_cb cb) {
     else {
         panda_cbs[type] = new_list;
     }
+    panda_cb_table_rebuild(type);
 }
 
 /**
@@ -282,6 +329,7 @@ void panda_disable_callback(void *plugin, panda_cb_type type, panda_cb cb) {
             }
         }
     }
+    if (found) panda_cb_table_rebuild(type);
     // no callback found to disable
     assert(found);
 }
@@ -308,6 +356,7 @@ void panda_enable_callback(void *plugin, panda_cb_type type, panda_cb cb) {
             }
         }
     }
+    if (found) panda_cb_table_rebuild(type);
     // no callback found to enable
     assert(found);
 }
@@ -350,9 +399,74 @@ void panda_unregister_callbacks(void *plugin) {
         }
         // update head
         panda_cbs[i] = plist_head;
+        panda_cb_table_rebuild(i);
+    }
+    for (int i = 0; i < panda_num_mem_ranges; i++) {
+        if (panda_mem_ranges[i].in_use && panda_mem_ranges[i].owner == plugin) {
+            panda_unregister_mem_range_callback(i);
+        }
+    }
+}
+
+// Pages are only marked as watched when their TLB entry is filled.
+static void panda_mem_ranges_changed(void) {
+    CPUState *cpu;
+    CPU_FOREACH(cpu) {
+        tlb_flush(cpu);
     }
 }
 
+/**
+ * @brief Registers a memory callback for the accesses that overlap
+ * [start, start + len) only.
+ *
+ * `type` must be one of the PANDA_CB_{VIRT,PHYS}_MEM_{BEFORE,AFTER}_{READ,WRITE}
+ * types, and the range is virtual or physical accordingly. If `asid` is not
+ * zero, the callback only runs while that address space is current.
+ *
+ * Unlike callbacks registered with panda_register_callback, this does not
+ * need panda_enable_memcb(): only accesses to pages that hold part of a
+ * watched range leave the TLB fast path, so the rest of guest memory is
+ * accessed at full speed.
+ *
+ * @return An id for panda_unregister_mem_range_callback.
+ */
+int panda_register_mem_range_callback(void *plugin, panda_cb_type type, panda_cb cb,
+                                      uint64_t start, uint64_t len, target_ulong asid) {
+    assert(type >= PANDA_CB_VIRT_MEM_BEFORE_READ && type <= PANDA_CB_PHYS_MEM_AFTER_WRITE);
+    assert(len > 0);
+
+    int id;
+    for (id = 0; id < panda_num_mem_ranges; id++) {
+        if (!panda_mem_ranges[id].in_use) break;
+    }
+    if (id == panda_num_mem_ranges) {
+        panda_num_mem_ranges++;
+        panda_mem_ranges = g_renew(panda_mem_range, panda_mem_ranges, panda_num_mem_ranges);
+    }
+    panda_mem_range *r = &panda_mem_ranges[id];
+    r->cb = cb;
+    r->owner = plugin;
+    r->type = type;
+    r->start = start;
+    r->end = start + len;
+    r->asid = asid;
+    r->in_use = true;
+
+    panda_mem_ranges_changed();
+    return id;
+}
+
+/**
+ * @brief Unregisters a memory callback registered with
+ * panda_register_mem_range_callback.
+ */
+void panda_unregister_mem_range_callback(int id) {
+    assert(id >= 0 && id < panda_num_mem_ranges && panda_mem_ranges[id].in_use);
+    panda_mem_ranges[id].in_use = false;
+    panda_mem_ranges_changed();
+}
+
 /**
  * @brief Enables the specified plugin.
  *
@@ -370,6 +484,7 @@ void panda_enable_plugin(void *plugin) {
             }
             plist = plist->next;
         }
+        panda_cb_table_rebuild(i);
     }
 }
 
@@ -390,6 +505,7 @@ void panda_disable_plugin(void *plugin) {
             }
             plist = plist->next;
         }
+        panda_cb_table_rebuild(i);
     }
 }
 
@@ -397,8 +513,8 @@ void panda_disable_plugin(void *plugin) {
  * @brief Allows to navigate the callback linked list skipping disabled callbacks.
  */
 panda_cb_list* panda_cb_list_next(panda_cb_list* plist) {
-    for (panda_cb_list* node = plist->next; plist != NULL; plist = plist->next) {
-        if (!node || node->enabled) return node;
+    for (panda_cb_list* node = plist->next; node != NULL; node = node->next) {
+        if (node->enabled) return node;
     }
     return NULL;
 }
@@ -450,11 +566,32 @@ void panda_enable_llvm(void) {
 void panda_disable_llvm(void) {
     panda_do_flush_tb();
     execute_llvm = 0;
+    executing_llvm = 0;
     generate_llvm = 0;
+    llvm_exec_filter = NULL;
     tcg_llvm_destroy();
     tcg_llvm_ctx = NULL;
 }
 
+// With a filter set, TBs keep their TCG code in LLVM mode and the filter
+// decides before each execution which version runs (true for LLVM).
+void panda_set_llvm_exec_filter(bool (*filter)(CPUState *cpu, TranslationBlock *tb)) {
+    llvm_exec_filter = filter;
+}
+
+// Abandon the TB running as TCG code and re-execute the current guest
+// instruction as LLVM code. Only valid from a before-memory-access callback.
+// Callbacks for the instruction run again, see plugin.h.
+void panda_restart_in_llvm(CPUState *cpu) {
+    assert(execute_llvm && !executing_llvm);
+    cpu->panda_force_llvm = true;
+    // The instruction has already been counted; it will be counted again.
+    if (rr_mode != RR_OFF) {
+        cpu->rr_guest_instr_count--;
+    }
+    cpu_loop_exit_restore(cpu, cpu->panda_mem_retaddr);
+}
+
 void panda_enable_llvm_helpers(void) {
     init_llvm_helpers();
 }
@@ -958,10 +1095,10 @@ void hmp_panda_list_plugins(Monitor *mon, const QDict *qdict) {
 }
 
 void hmp_panda_plugin_cmd(Monitor *mon, const QDict *qdict) {
-    panda_cb_list *plist;
     const char *cmd = qdict_get_try_str(qdict, "cmd");
-    for(plist = panda_cbs[PANDA_CB_MONITOR]; plist != NULL; plist = panda_cb_list_next(plist)) {
-        plist->entry.monitor(mon, cmd);
+    panda_cb_table *t = &panda_cb_tables[PANDA_CB_MONITOR];
+    for (int i = 0; i < t->n; i++) {
+        t->cbs[i].monitor(mon, cmd);
     }
 }
 
@@ -7,6 +7,8 @@
 
 #include <stdio.h>
 #include <unistd.h>
+#include <poll.h>
+#include <sys/mman.h>
 #include <sys/types.h>
 
 #include "qemu/osdep.h"
@@ -14,6 +16,10 @@
 
 #include "exec/exec-all.h"
 #include "exec/memory.h"
+#include "exec/ram_addr.h"
+#include "qemu/bitmap.h"
+#include "qemu/main-loop.h"
+#include "qemu/rcu.h"
 #include "io/channel-file.h"
 #include "migration/migration.h"
 #include "migration/qemu-file.h"
@@ -22,6 +28,8 @@
 
 #include "panda/rr/rr_log.h"
 #include "panda/common.h"
+#include "panda/plog-cc-bridge.h"
+#include "block/block.h"
 #include "qemu/memfd.h"
 
 #if defined CONFIG_LINUX && !defined CONFIG_MEMFD
@@ -48,6 +56,430 @@ extern unsigned long long rr_max_num_queue_entries;
 static size_t total_usage = 0;
 static size_t next_checkpoint_num = 0;
 
+bool checkpoint_incremental = false;
+bool checkpoint_fork = false;
+volatile sig_atomic_t checkpoint_fork_requested = 0;
+
+/*
+ * Incremental checkpoints.
+ *
+ * The first checkpoint stores every guest RAM page; later ones store only
+ * the pages QEMU's dirty-memory tracking reports as written since the
+ * previous checkpoint was taken or restored. Page contents are kept in a
+ * single store deduplicated by content hash, so identical pages (zeroes,
+ * unchanged code, pages written back with the same data) cost one copy.
+ */
+struct CheckpointPage {
+    uint64_t hash;
+    uint8_t data[TARGET_PAGE_SIZE];
+};
+
+static GHashTable *page_store = NULL; // hash -> CheckpointPage
+// The checkpoint whose RAM state the dirty bitmap is relative to.
+static Checkpoint *last_checkpoint = NULL;
+
+static uint64_t checkpoint_page_hash(const uint8_t *data) {
+    // 64-bit FNV-1a over words. Matches are confirmed with memcmp, so this
+    // only needs to spread well.
+    const uint64_t *words = (const uint64_t *)data;
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < TARGET_PAGE_SIZE / sizeof(uint64_t); i++) {
+        h ^= words[i];
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+static CheckpointPage *checkpoint_store_page(const uint8_t *data) {
+    uint64_t hash = checkpoint_page_hash(data);
+    CheckpointPage *page = g_hash_table_lookup(page_store, &hash);
+    if (page && memcmp(page->data, data, TARGET_PAGE_SIZE) == 0) {
+        return page;
+    }
+
+    CheckpointPage *new_page = g_new(CheckpointPage, 1);
+    new_page->hash = hash;
+    memcpy(new_page->data, data, TARGET_PAGE_SIZE);
+    // On a (rare) hash collision the new page just isn't shared.
+    if (!page) {
+        g_hash_table_insert(page_store, &new_page->hash, new_page);
+    }
+    total_usage += sizeof(CheckpointPage);
+    return new_page;
+}
+
+typedef struct {
+    Checkpoint *checkpoint;
+    size_t capacity;
+    bool all_pages;
+} CheckpointPagesArgs;
+
+static void checkpoint_add_page(Checkpoint *checkpoint, size_t *capacity,
+        uint64_t addr, const uint8_t *data) {
+    if (checkpoint->num_pages == *capacity) {
+        *capacity = *capacity ? 2 * *capacity : 4096;
+        checkpoint->page_addrs = g_renew(uint64_t, checkpoint->page_addrs, *capacity);
+        checkpoint->pages = g_renew(CheckpointPage *, checkpoint->pages, *capacity);
+    }
+    checkpoint->page_addrs[checkpoint->num_pages] = addr;
+    checkpoint->pages[checkpoint->num_pages] = checkpoint_store_page(data);
+    checkpoint->num_pages++;
+}
+
+static int checkpoint_save_block(const char *block_name, void *host_addr,
+        ram_addr_t offset, ram_addr_t length, void *opaque) {
+    CheckpointPagesArgs *args = (CheckpointPagesArgs *)opaque;
+    for (ram_addr_t off = 0; off < length; off += TARGET_PAGE_SIZE) {
+        // Always clear, so the next delta is relative to this checkpoint.
+        bool dirty = cpu_physical_memory_test_and_clear_dirty(offset + off,
+                TARGET_PAGE_SIZE, DIRTY_MEMORY_MIGRATION);
+        if (dirty || args->all_pages) {
+            checkpoint_add_page(args->checkpoint, &args->capacity,
+                    offset + off, (uint8_t *)host_addr + off);
+        }
+    }
+    return 0;
+}
+
+static int checkpoint_clear_block(const char *block_name, void *host_addr,
+        ram_addr_t offset, ram_addr_t length, void *opaque) {
+    cpu_physical_memory_test_and_clear_dirty(offset, length,
+            DIRTY_MEMORY_MIGRATION);
+    return 0;
+}
+
+typedef struct {
+    Checkpoint *target;
+    unsigned long *restored; // bitmap of pages already written
+} CheckpointRestoreArgs;
+
+static int checkpoint_restore_block(const char *block_name, void *host_addr,
+        ram_addr_t offset, ram_addr_t length, void *opaque) {
+    CheckpointRestoreArgs *args = (CheckpointRestoreArgs *)opaque;
+    // Walk from the target back to its base, so each page is written once
+    // with its newest saved contents.
+    for (Checkpoint *c = args->target; c != NULL; c = c->parent) {
+        for (size_t i = 0; i < c->num_pages; i++) {
+            uint64_t addr = c->page_addrs[i];
+            if (addr < offset || addr >= offset + length) continue;
+            unsigned long page = addr >> TARGET_PAGE_BITS;
+            if (test_bit(page, args->restored)) continue;
+            set_bit(page, args->restored);
+            memcpy((uint8_t *)host_addr + (addr - offset), c->pages[i]->data,
+                   TARGET_PAGE_SIZE);
+        }
+    }
+    return 0;
+}
+
+static int checkpoint_ram_end(const char *block_name, void *host_addr,
+        ram_addr_t offset, ram_addr_t length, void *opaque) {
+    ram_addr_t *end = (ram_addr_t *)opaque;
+    *end = MAX(*end, offset + length);
+    return 0;
+}
+
+static void checkpoint_save_incremental(Checkpoint *checkpoint) {
+    if (page_store == NULL) {
+        page_store = g_hash_table_new(g_int64_hash, g_int64_equal);
+        // From here on, TCG and DMA writes mark pages in the migration
+        // dirty bitmap. Existing TLB entries may map RAM writable without
+        // going through the notdirty path, so drop them.
+        memory_global_dirty_log_start();
+        CPUState *cpu;
+        CPU_FOREACH(cpu) {
+            tlb_flush(cpu);
+        }
+    }
+
+    checkpoint->incremental = true;
+    checkpoint->parent = last_checkpoint;
+    CheckpointPagesArgs args = {
+        .checkpoint = checkpoint,
+        .all_pages = (last_checkpoint == NULL),
+    };
+    qemu_ram_foreach_block(checkpoint_save_block, &args);
+    last_checkpoint = checkpoint;
+
+    QIOChannelFile *iochannel = qio_channel_file_new_fd(checkpoint->memfd);
+    QEMUFile *file = qemu_fopen_channel_output(QIO_CHANNEL(iochannel));
+    global_state_store_running();
+    qemu_save_device_state(file);
+    qemu_fflush(file);
+}
+
+static void checkpoint_restore_incremental(Checkpoint *checkpoint) {
+    ram_addr_t ram_end = 0;
+    qemu_ram_foreach_block(checkpoint_ram_end, &ram_end);
+    CheckpointRestoreArgs args = {
+        .target = checkpoint,
+        .restored = bitmap_new(ram_end >> TARGET_PAGE_BITS),
+    };
+    qemu_ram_foreach_block(checkpoint_restore_block, &args);
+    g_free(args.restored);
+
+    // Guest RAM is now exactly the checkpoint's, so further deltas are
+    // relative to it. Translations of the old contents must go too.
+    qemu_ram_foreach_block(checkpoint_clear_block, NULL);
+    last_checkpoint = checkpoint;
+    tb_flush(first_cpu);
+}
+
+static void checkpoint_save_rr_state(Checkpoint *checkpoint) {
+    checkpoint->guest_instr_count = rr_get_guest_instr_count();
+    checkpoint->nondet_log_position = rr_queue_head
+        ? rr_queue_head->header.file_pos
+        : rr_nondet_log->bytes_read;
+
+    memcpy(checkpoint->number_of_log_entries, rr_number_of_log_entries,
+            sizeof(rr_number_of_log_entries));
+    memcpy(checkpoint->size_of_log_entries, rr_size_of_log_entries,
+            sizeof(rr_size_of_log_entries));
+    checkpoint->max_num_queue_entries = rr_max_num_queue_entries;
+    checkpoint->next_progress = rr_next_progress;
+}
+
+/*
+ * Fork checkpoints.
+ *
+ * Instead of serializing the VM, fork() the replaying process and park the
+ * child at the checkpoint; copy-on-write makes this nearly free. A parked
+ * child waits for commands on a pipe. Each command makes it fork a new
+ * process that carries on replaying from the checkpoint, so the parked
+ * child stays available for later restores. Restoring hands the replay
+ * over to such a process and exits; panda_checkpoint_spawn starts one
+ * alongside the caller, e.g. to analyze a slice of the replay in parallel.
+ *
+ * Only the forking thread survives fork(), so the fork is done from the
+ * main loop with the vCPU paused, block I/O drained and the pandalog
+ * compressor threads stopped. A resumed process starts new TCG and RCU
+ * threads, gets main loop notifiers and thread pools of its own, and
+ * reopens the nondet log.
+ *
+ * A parked child exits once every process that could resume it is gone.
+ * The process the user started waits for all of its descendants before
+ * exiting, so the shell does not return while workers are still running.
+ */
+static Checkpoint *fork_pending = NULL;
+// Write end held by every process in the family, read end only by the root.
+static int family_pipe[2] = { -1, -1 };
+static bool fork_is_root = true;
+static void (*fork_resume_hook)(Checkpoint *, uint64_t) = NULL;
+
+static void checkpoint_fork_wait_family(void) {
+    if (!fork_is_root || family_pipe[0] < 0) return;
+
+    // Parked children only exit once their command pipes are closed.
+    for (int i = 0; i < next_checkpoint_num; i++) {
+        if (checkpoints[i]->fork_pid > 0) {
+            close(checkpoints[i]->fork_pipe);
+            checkpoints[i]->fork_pid = 0;
+        }
+    }
+    close(family_pipe[1]);
+    char c;
+    ssize_t n;
+    do {
+        n = read(family_pipe[0], &c, 1);
+    } while (n > 0 || (n < 0 && errno == EINTR));
+    close(family_pipe[0]);
+    family_pipe[0] = family_pipe[1] = -1;
+}
+
+// Guest RAM is MADV_DONTFORK (for KVM's sake), so a child would not have
+// any; allow it to be inherited while we fork.
+static void checkpoint_ram_inherit(bool inherit) {
+    RAMBlock *block;
+    rcu_read_lock();
+    QLIST_FOREACH_RCU(block, &ram_list.blocks, next) {
+#ifdef MADV_DOFORK
+        if (inherit) {
+            madvise(block->host, block->max_length, MADV_DOFORK);
+            continue;
+        }
+#endif
+        qemu_madvise(block->host, block->max_length, QEMU_MADV_DONTFORK);
+    }
+    rcu_read_unlock();
+}
+
+// In a process just forked from a parked child, which is now resuming the
+// replay at checkpoint through command pipe cmd_fd.
+static void checkpoint_after_fork(Checkpoint *checkpoint, int cmd_fd,
+        uint64_t stop_instr_count) {
+    fork_is_root = false;
+    rcu_after_fork();
+    qemu_main_loop_after_fork();
+    qemu_tcg_vcpus_after_fork();
+    rr_nondet_log_reopen_after_fork();
+
+    checkpoint->fork_pipe = cmd_fd;
+    checkpoint->fork_pid = getppid();
+    rr_replay_stop_instr_count = stop_instr_count;
+    rr_update_chain_limit();
+
+    if (fork_resume_hook) {
+        fork_resume_hook(checkpoint, stop_instr_count);
+    }
+}
+
+// Runs in the parked child. Only returns in a resumed process.
+static void checkpoint_park(Checkpoint *checkpoint, int cmd_fd) {
+    GArray *fds = g_array_new(FALSE, FALSE, sizeof(struct pollfd));
+    struct pollfd pfd = { .fd = cmd_fd, .events = POLLIN };
+    g_array_append_val(fds, pfd);
+
+    while (fds->len > 0) {
+        if (poll((struct pollfd *)fds->data, fds->len, -1) < 0) {
+            if (errno == EINTR) continue;
+            perror("checkpoint: poll");
+            break;
+        }
+        while (waitpid(-1, NULL, WNOHANG) > 0) {}
+
+        for (int i = (int)fds->len - 1; i >= 0; i--) {
+            int fd = g_array_index(fds, struct pollfd, i).fd;
+            if (!g_array_index(fds, struct pollfd, i).revents) continue;
+
+            uint64_t stop_instr_count;
+            ssize_t n = read(fd, &stop_instr_count, sizeof(stop_instr_count));
+            if (n < 0 && errno == EINTR) continue;
+            if (n != sizeof(stop_instr_count)) {
+                // Nobody holding this pipe is left to resume us through it.
+                close(fd);
+                g_array_remove_index_fast(fds, i);
+                continue;
+            }
+
+            // Every resumed process gets a pipe of its own, as this
+            // process cannot give away its read end of cmd_fd.
+            int new_pipe[2];
+            if (pipe(new_pipe) < 0) {
+                perror("checkpoint: pipe");
+                continue;
+            }
+            pid_t pid = fork();
+            if (pid == 0) {
+                for (guint j = 0; j < fds->len; j++) {
+                    close(g_array_index(fds, struct pollfd, j).fd);
+                }
+                g_array_free(fds, TRUE);
+                close(new_pipe[0]);
+                checkpoint_after_fork(checkpoint, new_pipe[1], stop_instr_count);
+                return;
+            }
+            close(new_pipe[1]);
+            if (pid < 0) {
+                perror("checkpoint: fork");
+                close(new_pipe[0]);
+                continue;
+            }
+            pfd.fd = new_pipe[0];
+            g_array_append_val(fds, pfd);
+        }
+    }
+    _exit(0);
+}
+
+/*
+ * Take the fork checkpoint requested by panda_checkpoint. Called from the
+ * main loop with the iothread lock held.
+ */
+void panda_checkpoint_do_fork(void) {
+    Checkpoint *checkpoint = fork_pending;
+    fork_pending = NULL;
+    checkpoint_fork_requested = 0;
+    if (checkpoint == NULL) return;
+
+    if (family_pipe[1] < 0) {
+        if (pipe(family_pipe) < 0) {
+            perror("checkpoint: pipe");
+            return;
+        }
+        atexit(checkpoint_fork_wait_family);
+    }
+    int cmd_pipe[2];
+    if (pipe(cmd_pipe) < 0) {
+        perror("checkpoint: pipe");
+        return;
+    }
+
+    pause_all_vcpus();
+    checkpoint_save_rr_state(checkpoint);
+    // Nothing may be in flight on a thread the children will not have.
+    bdrv_drain_all();
+    pandalog_cc_stop_threads();
+
+    // Don't let the child flush output buffered before the fork again.
+    fflush(stdout);
+    fflush(stderr);
+    checkpoint_ram_inherit(true);
+    pid_t pid = fork();
+    if (pid < 0) {
+        perror("checkpoint: fork");
+        checkpoint_ram_inherit(false);
+        close(cmd_pipe[0]);
+        close(cmd_pipe[1]);
+    } else if (pid == 0) {
+        fork_is_root = false;
+        close(cmd_pipe[1]);
+        if (family_pipe[0] >= 0) {
+            close(family_pipe[0]);
+            family_pipe[0] = -1;
+        }
+        checkpoint_park(checkpoint, cmd_pipe[0]);
+    } else {
+        // The parked child keeps RAM inheritable for the processes it forks.
+        checkpoint_ram_inherit(false);
+        close(cmd_pipe[0]);
+        checkpoint->fork_pipe = cmd_pipe[1];
+        checkpoint->fork_pid = pid;
+        printf("Created checkpoint @ %lu in process %d\n",
+                checkpoint->guest_instr_count, pid);
+    }
+
+    resume_all_vcpus();
+}
+
+static int checkpoint_fork_resume(Checkpoint *checkpoint,
+        uint64_t stop_instr_count) {
+    if (checkpoint->fork_pid <= 0) {
+        fprintf(stderr, "checkpoint: no process parked at checkpoint @ %lu\n",
+                checkpoint->guest_instr_count);
+        return -1;
+    }
+    ssize_t n = write(checkpoint->fork_pipe, &stop_instr_count,
+            sizeof(stop_instr_count));
+    if (n != sizeof(stop_instr_count)) {
+        perror("checkpoint: resume");
+        return -1;
+    }
+    return 0;
+}
+
+/*
+ * Start another process replaying from a fork checkpoint, while the caller
+ * carries on. It stops once stop_instr_count instructions have been
+ * replayed (0: at the end of the replay).
+ *
+ * Returns 0 on success, -1 otherwise.
+ */
+int panda_checkpoint_spawn(Checkpoint *checkpoint, uint64_t stop_instr_count) {
+    fflush(stdout);
+    fflush(stderr);
+    return checkpoint_fork_resume(checkpoint, stop_instr_count);
+}
+
+/*
+ * Have hook called in every process resumed from a fork checkpoint, before
+ * it starts replaying. It runs in the main loop with the vCPUs paused, so
+ * it may e.g. load plugins or open a pandalog of the process's own.
+ */
+void panda_checkpoint_set_resume_hook(void (*hook)(Checkpoint *checkpoint,
+        uint64_t stop_instr_count)) {
+    fork_resume_hook = hook;
+}
+
 /*
  * Returns closest checkpoint containing target_instr_count 
  * If target is start of a checkpoint, returns prev checkpoint num
@@ -78,6 +510,10 @@ size_t get_num_checkpoints(void) {
     return next_checkpoint_num;
 }
 
+size_t get_checkpoint_usage(void) {
+    return total_usage;
+}
+
 /*
  * Gets checkpoint from array by idx.
  * If idx <= 0, return last one
@@ -105,6 +541,11 @@ void *panda_checkpoint(void) {
         return NULL;
     }
 
+    if (checkpoint_fork && fork_pending != NULL) {
+        // Still waiting for the main loop to take the previous one.
+        return NULL;
+    }
+
     uint64_t instr_count = rr_get_guest_instr_count();
 
     /* Find last existing checkpoint before this point */
@@ -114,39 +555,56 @@ void *panda_checkpoint(void) {
         //if (check->guest_instr_count > instr_count) break;
     //}
 
-    Checkpoint *checkpoint = (Checkpoint *)malloc(sizeof(Checkpoint));
+    Checkpoint *checkpoint = g_new0(Checkpoint, 1);
 
     // TODO: Do we want to insert checkpoint in list in order?
     checkpoints[next_checkpoint_num] = checkpoint;
     next_checkpoint_num++;
-    checkpoint->guest_instr_count = instr_count;
-    checkpoint->nondet_log_position = rr_queue_head
-        ? rr_queue_head->header.file_pos
-        : rr_nondet_log->bytes_read;
 
-    memcpy(checkpoint->number_of_log_entries, rr_number_of_log_entries,
-            sizeof(rr_number_of_log_entries));
-    memcpy(checkpoint->size_of_log_entries, rr_size_of_log_entries,
-            sizeof(rr_size_of_log_entries));
-    checkpoint->max_num_queue_entries = rr_max_num_queue_entries;
-    checkpoint->next_progress = rr_next_progress;
+    if (checkpoint_fork) {
+        // fork() needs the vCPU thread out of the way, so stop it here and
+        // let the main loop fork, which also records the replay state.
+        checkpoint->memfd = -1;
+        checkpoint->fork_pipe = -1;
+        fork_pending = checkpoint;
+        checkpoint_fork_requested = 1;
+        if (qemu_in_vcpu_thread()) {
+            first_cpu->stop = true;
+            cpu_exit(first_cpu);
+            qemu_notify_event();
+        } else {
+            panda_checkpoint_do_fork();
+        }
+        return checkpoint;
+    }
+
+    checkpoint_save_rr_state(checkpoint);
 
     checkpoint->memfd = memfd_create("checkpoint", 0);
     assert(checkpoint->memfd >= 0);
 
-    QIOChannelFile *iochannel = qio_channel_file_new_fd(checkpoint->memfd);
-    QEMUFile *file = qemu_fopen_channel_output(QIO_CHANNEL(iochannel));
+    size_t usage_before = total_usage;
+    if (checkpoint_incremental) {
+        checkpoint_save_incremental(checkpoint);
+    } else {
+        checkpoint->incremental = false;
+        checkpoint->parent = NULL;
+        checkpoint->num_pages = 0;
 
-    global_state_store_running();
-    qemu_savevm_state(file, NULL);
+        QIOChannelFile *iochannel = qio_channel_file_new_fd(checkpoint->memfd);
+        QEMUFile *file = qemu_fopen_channel_output(QIO_CHANNEL(iochannel));
 
-    qemu_fflush(file);
+        global_state_store_running();
+        qemu_savevm_state(file, NULL);
+
+        qemu_fflush(file);
+    }
     checkpoint->memfd_usage = lseek(checkpoint->memfd, 0, SEEK_CUR);
     total_usage += checkpoint->memfd_usage;
 
-    printf("Created checkpoint @ %lu. Size %.1f MB. Total usage %.1f GB\n",
-            instr_count, ((float) checkpoint->memfd_usage) / (1 << 20),
-            ((float) total_usage) / (1 << 30));
+    printf("Created checkpoint @ %lu. Size %.1f MB (%zu pages). Total usage %.1f GB\n",
+            instr_count, ((float) (total_usage - usage_before)) / (1 << 20),
+            checkpoint->num_pages, ((float) total_usage) / (1 << 30));
 
     return checkpoint;
 }
@@ -167,7 +625,16 @@ void panda_restore(void *opaque) {
     
     Checkpoint *checkpoint = (Checkpoint *)opaque;
     printf("Restarting checkpoint @ instr count %lu\n", checkpoint->guest_instr_count);
-        
+
+    if (checkpoint->memfd < 0) {
+        fflush(stdout);
+        fflush(stderr);
+        if (checkpoint_fork_resume(checkpoint, 0) < 0) return;
+        // The resumed process takes over from here.
+        checkpoint_fork_wait_family();
+        _exit(0);
+    }
+
     lseek(checkpoint->memfd, 0, SEEK_SET);
 
     QIOChannelFile *iochannel = qio_channel_file_new_fd(checkpoint->memfd);
@@ -181,11 +648,13 @@ void panda_restore(void *opaque) {
 
     migration_incoming_state_destroy();
 
+    if (checkpoint->incremental) {
+        checkpoint_restore_incremental(checkpoint);
+    }
+
     first_cpu->rr_guest_instr_count = checkpoint->guest_instr_count;
     first_cpu->panda_guest_pc = panda_current_pc(first_cpu);
-    rr_nondet_log->bytes_read = checkpoint->nondet_log_position;
-    fseek(rr_nondet_log->fp, checkpoint->nondet_log_position, SEEK_SET);
-    rr_queue_head = rr_queue_tail = NULL;
+    rr_nondet_log_seek(checkpoint->nondet_log_position);
 
     memcpy(rr_number_of_log_entries, checkpoint->number_of_log_entries,
             sizeof(rr_number_of_log_entries));
@@ -107,6 +107,45 @@ target_ulong panda_current_asid(CPUState *cpu) {
 #endif
 }
 
+PandaVCacheEntry panda_vcache[PANDA_VCACHE_SIZE];
+// Starts above the zero generation of the (zeroed) entries.
+uint64_t panda_vcache_generation = 1;
+
+/**
+ * @brief Drops all cached translations. Called whenever the softmmu TLB
+ * is flushed, even for a single page: the cache may hold pieces of a
+ * large page that the TLB does not know about.
+ */
+void panda_vcache_flush(void) {
+    panda_vcache_generation++;
+}
+
+/**
+ * @brief Slow path of panda_virt_page_to_host() for reads: walks the page
+ * tables and caches the translation if \p page is RAM.
+ */
+uint8_t *panda_vcache_fill(CPUState *env, target_ulong page) {
+    hwaddr phys_addr = cpu_get_phys_page_debug(env, page);
+    if (phys_addr == -1) {
+        return NULL;
+    }
+
+    hwaddr l = TARGET_PAGE_SIZE;
+    hwaddr addr1;
+    MemoryRegion *mr = address_space_translate(&address_space_memory, phys_addr,
+                                               &addr1, &l, false);
+    if (l < TARGET_PAGE_SIZE || !memory_access_is_direct(mr, false)) {
+        return NULL;
+    }
+
+    PandaVCacheEntry *e = &panda_vcache[(page >> TARGET_PAGE_BITS) & (PANDA_VCACHE_SIZE - 1)];
+    e->generation = panda_vcache_generation;
+    e->asid = panda_vcache_asid(env);
+    e->page = page;
+    e->host = qemu_map_ram_ptr(mr->ram_block, addr1);
+    return e->host;
+}
+
 target_ulong panda_current_pc(CPUState *cpu) {
     CPUArchState *env = (CPUArchState *)cpu->env_ptr;
     target_ulong pc, cs_base;
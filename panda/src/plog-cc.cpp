@@ -1,8 +1,14 @@
 
 #include <iostream>
 #include <math.h>
+#include <signal.h>
 #include <fstream>
 #include <memory>
+#include <algorithm>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 #include "panda/plog-cc.hpp"
 #include "panda/plog-cc-bridge.h"
 
@@ -10,6 +16,37 @@ using namespace std;
 
 extern int panda_in_main_loop;
 
+// A chunk that has been handed to the compressor threads.
+struct PandalogCcJob {
+    unsigned char *buf;         // uncompressed chunk data, owned by the job
+    uint32_t buf_cap;
+    uint32_t len;
+    std::vector<unsigned char> zbuf;
+    uint32_t zlen;
+    uint64_t start_instr;
+    uint32_t num_entries;
+    bool done;                  // compressed, waiting to be written
+};
+
+// Chunks are compressed by a pool of threads so that the vCPU thread only
+// has to swap buffers when a chunk fills up. Whichever thread finishes the
+// oldest outstanding chunk writes out all finished chunks, so the file and
+// directory stay in chunk order.
+struct PandalogCcWriter {
+    std::mutex lock;
+    std::condition_variable work;       // signalled when a chunk is queued
+    std::condition_variable written;    // signalled when chunks are written
+    std::deque<PandalogCcJob *> queue;     // not yet picked up by a thread
+    std::deque<PandalogCcJob *> inflight;  // all unwritten chunks, in order
+    std::vector<PandalogCcJob *> free_jobs;
+    std::vector<std::thread> threads;
+    bool stop = false;
+};
+
+// Bound on unwritten chunks, so a slow disk throttles the guest rather
+// than memory use growing without bound.
+#define PL_MAX_INFLIGHT (PL_COMPRESS_THREADS + 2)
+
 void PandaLog::create(uint32_t chunk_size) {
     this->chunk.size = chunk_size;
     this->chunk.zsize = chunk_size;
@@ -18,6 +55,7 @@ void PandaLog::create(uint32_t chunk_size) {
     // chunk.  this should be big enough but don't worry, we'll be monitoring it.
     this->chunk.buf = (unsigned char *) malloc(this->chunk.size);
     this->chunk.buf_p = this->chunk.buf;
+    this->chunk.buf_cap = this->chunk.size;
     this->chunk.zbuf = (unsigned char *) malloc(this->chunk.zsize);
     this->chunk.start_pos = PL_HEADER_SIZE;
     this->chunk.entries = std::vector<std::unique_ptr<panda::LogEntry>>();
@@ -28,6 +66,11 @@ void PandaLog::read_dir(){
     PlHeader *plh = read_header();
 
     printf("Header: version: %u dir_pos: %lu chunk_size: %u\n", plh->version, plh->dir_pos, plh->chunk_size);
+    if (plh->version > PL_CURRENT_VERSION) {
+        printf("Unsupported pandalog version %u\n", plh->version);
+        exit(1);
+    }
+    this->codec = (plh->version >= 3) ? plh->codec : PL_CODEC_ZLIB;
     
     this->chunk.size = plh->chunk_size;
     this->chunk.zsize = plh->chunk_size;
@@ -61,7 +104,8 @@ void PandaLog::read_dir(){
     }
 
     // a little hack so unmarshall_chunk will work
-    this->dir.pos[num_chunks] = plh->dir_pos;
+    this->dir.pos.push_back(plh->dir_pos);
+    delete plh;
 }
 
 PlHeader* PandaLog::read_header(){
@@ -209,10 +253,12 @@ void PandaLog::write_dir(){
 
     //create header
     PlHeader plh;
+    memset(&plh, 0, sizeof(plh));
     plh.version = PL_CURRENT_VERSION;
     
     plh.dir_pos = this->file->tellp();
     plh.chunk_size = this->chunk.size;
+    plh.codec = this->codec;
 
     printf("header: version=%d  dir_pos=%lu chunk_size=%d\n",
             plh.version, plh.dir_pos, plh.chunk_size);
@@ -230,19 +276,11 @@ void PandaLog::write_dir(){
     write_header(&plh);
 }
 
-void PandaLog::add_dir_entry(){
-    // this is start instr and start file position for this chunk
-    this->dir.instr.push_back(this->chunk.start_instr);
-    this->dir.pos.push_back(this->chunk.start_pos);
-    // and this is the number of entries in this chunk
-    this->dir.num_entries.push_back(this->chunk.ind_entry);
-}
-
 int PandaLog::close(){
 
     if (this->mode == PL_MODE_WRITE){
         write_current_chunk();
-        add_dir_entry();
+        stop_writer();
         write_dir();
     }
 
@@ -250,42 +288,76 @@ int PandaLog::close(){
     return 0;
 }
 
-// compress current chunk and write it to file,
-// also update directory map
+bool PandaLog::set_codec(const char *spec){
+    // the codec applies to the whole file
+    assert(this->writer == NULL);
+    if (0 == strcmp(spec, "none")) {
+        this->codec = PL_CODEC_NONE;
+        return true;
+    }
+    if (0 == strncmp(spec, "zlib", 4)) {
+        int level = PL_Z_LEVEL;
+        if (spec[4] == ':') {
+            level = atoi(spec + 5);
+        } else if (spec[4] != '\0') {
+            return false;
+        }
+        if (level < Z_BEST_SPEED || level > Z_BEST_COMPRESSION) return false;
+        this->codec = PL_CODEC_ZLIB;
+        this->z_level = level;
+        return true;
+    }
+    return false;
+}
+
+// hand the current chunk to the compressor threads and start a new one
 void PandaLog::write_current_chunk(){
 #ifndef PLOG_READER 
-    //uncompressed chunk size
-    unsigned long chunk_sz = this->chunk.buf_p - this->chunk.buf;
-    unsigned long ccs = this->chunk.zsize;
-    int ret;
+    PandalogCcWriter *w = this->writer;
+    if (w == NULL) {
+        w = this->writer = new PandalogCcWriter();
+        // Like qemu_thread_create(), keep signals on the vCPU thread.
+        sigset_t all, old;
+        sigfillset(&all);
+        pthread_sigmask(SIG_SETMASK, &all, &old);
+        for (int i = 0; i < PL_COMPRESS_THREADS; i++) {
+            w->threads.emplace_back(&PandaLog::compress_chunks, this);
+        }
+        pthread_sigmask(SIG_SETMASK, &old, NULL);
+    }
 
-    // loop allows compress2 to fail and resize output buffer as needed
-    uint32_t i;
-    for (i=0; i<10; i++) {
-        ret = compress2(this->chunk.zbuf, &ccs, this->chunk.buf, chunk_sz, Z_BEST_COMPRESSION);
-        
-        if (ret == Z_OK) break;
-        // bigger output buffer needed to perform compression?
-        this->chunk.zsize *= 2;
-        this->chunk.zbuf = (unsigned char *) realloc(this->chunk.zbuf, this->chunk.zsize);
-        assert (this->chunk.zbuf != NULL);
-    }
-
-    // ccs is final compressed chunk size
-    assert(ret == Z_OK);
-    printf("writing chunk %u of pandalog, %lu / %lu = %.2f compression, %u entries\n",
-            this->chunk_num, chunk_sz, ccs, ((float)chunk_sz) / ccs,
-            this->chunk.ind_entry);
     if (this->chunk.ind_entry == 0) {
         printf("WARNING: Empty chunk written to pandalog. Did you forget?\n");
     }
 
-    this->file->write((char*)this->chunk.zbuf, ccs);
-    //assert(this->)
-    add_dir_entry();
-    // reset start instr / pos
+    std::unique_lock<std::mutex> l(w->lock);
+    w->written.wait(l, [w]{ return w->inflight.size() < PL_MAX_INFLIGHT; });
+
+    PandalogCcJob *job;
+    if (w->free_jobs.empty()) {
+        job = new PandalogCcJob();
+        job->buf = (unsigned char *) malloc(this->chunk.size);
+        job->buf_cap = this->chunk.size;
+        assert(job->buf != NULL);
+    } else {
+        job = w->free_jobs.back();
+        w->free_jobs.pop_back();
+    }
+    // swap buffers: the job takes the filled chunk, we keep writing into
+    // the job's old buffer
+    std::swap(job->buf, this->chunk.buf);
+    std::swap(job->buf_cap, this->chunk.buf_cap);
+    job->len = this->chunk.buf_p - job->buf;
+    job->start_instr = this->chunk.start_instr;
+    job->num_entries = this->chunk.ind_entry;
+    job->done = false;
+    w->inflight.push_back(job);
+    w->queue.push_back(job);
+    w->work.notify_one();
+    l.unlock();
+
+    // reset start instr
     this->chunk.start_instr = rr_get_guest_instr_count();
-    this->chunk.start_pos = this->file->tellg();
     // rewind chunk buf and inc chunk #
     this->chunk.buf_p = this->chunk.buf;
     this->chunk_num ++;
@@ -293,6 +365,75 @@ void PandaLog::write_current_chunk(){
 #endif
 }
 
+// compressor thread: compress queued chunks, then write out every finished
+// chunk at the head of the in-flight list
+void PandaLog::compress_chunks(){
+    PandalogCcWriter *w = this->writer;
+    std::unique_lock<std::mutex> l(w->lock);
+    while (true) {
+        w->work.wait(l, [w]{ return w->stop || !w->queue.empty(); });
+        if (w->queue.empty()) break;
+        PandalogCcJob *job = w->queue.front();
+        w->queue.pop_front();
+        l.unlock();
+
+        if (this->codec == PL_CODEC_ZLIB) {
+            unsigned long ccs = compressBound(job->len);
+            job->zbuf.resize(ccs);
+            int ret = compress2(job->zbuf.data(), &ccs, job->buf, job->len, this->z_level);
+            assert(ret == Z_OK);
+            job->zlen = ccs;
+        } else {
+            job->zlen = job->len;
+        }
+
+        l.lock();
+        job->done = true;
+        while (!w->inflight.empty() && w->inflight.front()->done) {
+            PandalogCcJob *j = w->inflight.front();
+            w->inflight.pop_front();
+            const unsigned char *data = (this->codec == PL_CODEC_ZLIB) ? j->zbuf.data() : j->buf;
+            printf("writing chunk %zu of pandalog, %u / %u = %.2f compression, %u entries\n",
+                    this->dir.pos.size(), j->len, j->zlen, ((float)j->len) / j->zlen,
+                    j->num_entries);
+            this->dir.instr.push_back(j->start_instr);
+            this->dir.pos.push_back(this->file->tellp());
+            this->dir.num_entries.push_back(j->num_entries);
+            this->file->write((const char *)data, j->zlen);
+            w->free_jobs.push_back(j);
+        }
+        w->written.notify_all();
+    }
+}
+
+void PandaLog::stop_writer(){
+    PandalogCcWriter *w = this->writer;
+    if (w == NULL) return;
+    {
+        std::lock_guard<std::mutex> l(w->lock);
+        w->stop = true;
+        w->work.notify_all();
+    }
+    for (auto &t : w->threads) {
+        t.join();
+    }
+    // threads only exit once the queue is empty, and the last one to
+    // finish a chunk has written everything before it
+    assert(w->inflight.empty());
+    for (PandalogCcJob *job : w->free_jobs) {
+        free(job->buf);
+        delete job;
+    }
+    delete w;
+    this->writer = NULL;
+}
+
+void PandaLog::quiesce(){
+    if (this->mode != PL_MODE_WRITE) return;
+    stop_writer();
+    this->file->flush();
+}
+
 uint64_t last_instr_entry = -1;
 
 void PandaLog::write_entry(std::unique_ptr<panda::LogEntry> entry){
@@ -319,12 +460,13 @@ void PandaLog::write_entry(std::unique_ptr<panda::LogEntry> entry){
 
     // create another chunk
     if (this->chunk.buf_p + sizeof(uint32_t) + n
-        >= this->chunk.buf + ((int)(floor(this->chunk.size)))) {
+        >= this->chunk.buf + this->chunk.buf_cap) {
 
         uint32_t offset = this->chunk.buf_p - this->chunk.buf;
-        uint32_t new_size = offset * 2;
+        uint32_t new_size = std::max<uint32_t>(offset * 2, offset + sizeof(uint32_t) + n + 1);
         this->chunk.buf = (unsigned char *) realloc(this->chunk.buf, new_size);
         this->chunk.buf_p = this->chunk.buf + offset;
+        this->chunk.buf_cap = new_size;
         assert (this->chunk.buf != NULL);
     }
 
@@ -346,16 +488,32 @@ void PandaLog::unmarshall_chunk(uint32_t chunk_num){
     // read compressed chunk data off disk
     this->file->seekg(this->dir.pos[chunk_num]);
 
-    unsigned long compressed_size = this->dir.pos[chunk_num+1] - this->dir.pos[chunk_num] + 1;
-     this->file->read((char* ) chunk->zbuf, compressed_size);
+    unsigned long compressed_size = this->dir.pos[chunk_num+1] - this->dir.pos[chunk_num];
+    if (compressed_size > chunk->zsize) {
+        chunk->zsize = compressed_size;
+        chunk->zbuf = (unsigned char *) realloc(chunk->zbuf, chunk->zsize);
+        assert (chunk->zbuf != NULL);
+    }
+    this->file->read((char* ) chunk->zbuf, compressed_size);
     assert (this->file->gcount() == compressed_size);
     unsigned long uncompressed_size = chunk->size;
 
+    if (this->codec == PL_CODEC_NONE) {
+        // stored as is; it may be bigger than the nominal chunk size
+        if (compressed_size > chunk->size) {
+            chunk->size = compressed_size;
+            free(chunk->buf);
+            chunk->buf = (unsigned char *)malloc(chunk->size);
+            chunk->buf_p = chunk->buf;
+        }
+        memcpy(chunk->buf, chunk->zbuf, compressed_size);
+    }
+
     // uncompress it
     printf ("chunk size=%lu compressed=%lu\n", uncompressed_size, compressed_size);
 
     int ret;
-    while (true) {
+    while (this->codec == PL_CODEC_ZLIB) {
         ret = uncompress(chunk->buf, &uncompressed_size, chunk->zbuf, compressed_size);
 
         printf ("ret = %d\n", ret);
@@ -482,6 +640,10 @@ void pandalog_cc_init_write(const char * fname){
     globalLog.open(fname, "w");
 }
 
+bool pandalog_cc_set_codec(const char *spec){
+    return globalLog.set_codec(spec);
+}
+
 void pandalog_cc_init_read(const char * fname){
     globalLog.open(fname, "r");
 }
@@ -498,6 +660,10 @@ void pandalog_cc_close(){
     globalLog.close();
 }
 
+void pandalog_cc_stop_threads(){
+    globalLog.quiesce();
+}
+
 
 // Unpack entry from buffer into C++ protobuf object
 // and write it to the log
@@ -45,6 +45,7 @@
 #include "qmp-commands.h"
 #include "hmp.h"
 #include "panda/rr/rr_log.h"
+#include "panda/rr/rr_snapshot.h"
 #include "migration/migration.h"
 #include "include/exec/address-spaces.h"
 #include "include/exec/exec-all.h"
@@ -54,6 +55,8 @@
 #include "panda/callback_support.h"
 #include "exec/gdbstub.h"
 #include "sysemu/cpus.h"
+#include "qemu/atomic.h"
+#include "qemu/thread.h"
 
 /******************************************************************************************/
 /* GLOBALS */
@@ -110,6 +113,10 @@ volatile sig_atomic_t rr_end_record_requested = 0;
 volatile sig_atomic_t rr_end_replay_requested = 0;
 char* rr_requested_name = NULL;
 char* rr_snapshot_name = NULL;
+bool rr_log_compress = false;
+bool rr_snapshot_background = false;
+// Stop replaying once this many guest instructions have run. 0 = never.
+uint64_t rr_replay_stop_instr_count = 0;
 
 unsigned rr_next_progress = 1;
 
@@ -128,6 +135,10 @@ RR_log_entry* rr_get_queue_head(void) { return rr_queue_head; }
 // 2) The only thing in the queue is RR_END_OF_LOG
 uint8_t rr_replay_finished(void)
 {
+    if (rr_replay_stop_instr_count
+            && rr_get_guest_instr_count() >= rr_replay_stop_instr_count) {
+        return true;
+    }
     return rr_log_is_empty()
         && rr_queue_head->header.kind == RR_END_OF_LOG
         && rr_get_guest_instr_count() >=
@@ -262,10 +273,182 @@ static inline void rr_assert_fail(const char* exp, const char* file, int line,
 /* RECORD */
 /******************************************************************************************/
 
+// Recorded entries are serialized into a single-producer, single-consumer
+// byte ring, which a background thread drains into the log (compressing it
+// for v2), so the vCPU thread never calls fwrite or zlib. If the ring fills
+// up, the vCPU thread waits for the writer: entries are never dropped.
+// For v2 logs, the start of each entry is also pushed to a ring of marks,
+// so the writer can keep blocks on entry boundaries.
+
+#define RR_WRITEBUF_SIZE (64 << 20) // must be a power of 2
+#define RR_WRITE_MARKS_LEN 65536    // must be a power of 2
+
+typedef struct {
+    uint64_t pos; // ring position at which the entry starts
+    uint64_t instr_count;
+} RR_write_mark;
+
+static uint8_t *rr_writebuf;
+static RR_write_mark *rr_write_marks;
+// Free-running indices: heads are only written by the vCPU thread, tails
+// only by the writer thread.
+static uint64_t rr_writebuf_head;
+static uint64_t rr_writebuf_tail;
+static unsigned rr_write_mark_head;
+static unsigned rr_write_mark_tail;
+static QemuEvent rr_writebuf_not_empty;
+static QemuEvent rr_writebuf_not_full;
+static QemuThread rr_writer_thread;
+static bool rr_writer_running = false;
+static bool rr_writer_stop;
+static bool rr_writer_failed;
+// Number of times the vCPU thread had to wait for the writer.
+static uint64_t rr_writer_stalls;
+
+// Append to the log file. Called from the writer thread while it runs.
+static void rr_log_sink_write(const void *ptr, size_t len)
+{
+    if (rr_nondet_log->writer) {
+        rr_block_writer_write(rr_nondet_log->writer, ptr, len);
+    } else if (fwrite(ptr, 1, len, rr_nondet_log->fp) != len) {
+        atomic_set(&rr_writer_failed, true);
+    }
+}
+
+// Blocks of a v2 log are compressed and written out between entries.
+static void rr_log_sink_end_entry(void)
+{
+    if (!rr_block_writer_end_entry(rr_nondet_log->writer)) {
+        atomic_set(&rr_writer_failed, true);
+    }
+}
+
+static void rr_writebuf_wait_not_full(void)
+{
+    rr_writer_stalls++;
+    qemu_event_set(&rr_writebuf_not_empty);
+    qemu_event_reset(&rr_writebuf_not_full);
+    if (rr_writebuf_head - atomic_load_acquire(&rr_writebuf_tail) == RR_WRITEBUF_SIZE ||
+        rr_write_mark_head - atomic_load_acquire(&rr_write_mark_tail) == RR_WRITE_MARKS_LEN) {
+        qemu_event_wait(&rr_writebuf_not_full);
+    }
+}
+
+static void rr_writebuf_put(const uint8_t *ptr, size_t len)
+{
+    while (len > 0) {
+        uint64_t head = rr_writebuf_head;
+        uint64_t space = RR_WRITEBUF_SIZE - (head - atomic_load_acquire(&rr_writebuf_tail));
+        if (space == 0) {
+            rr_writebuf_wait_not_full();
+            continue;
+        }
+        uint64_t off = head % RR_WRITEBUF_SIZE;
+        size_t n = MIN(MIN(len, space), RR_WRITEBUF_SIZE - off);
+        memcpy(rr_writebuf + off, ptr, n);
+        atomic_store_release(&rr_writebuf_head, head + n);
+        ptr += n;
+        len -= n;
+    }
+}
+
+static void rr_writebuf_mark(uint64_t instr_count)
+{
+    while (rr_write_mark_head - atomic_load_acquire(&rr_write_mark_tail) == RR_WRITE_MARKS_LEN) {
+        rr_writebuf_wait_not_full();
+    }
+    rr_write_marks[rr_write_mark_head % RR_WRITE_MARKS_LEN] = (RR_write_mark) {
+        .pos = rr_writebuf_head,
+        .instr_count = instr_count,
+    };
+    atomic_store_release(&rr_write_mark_head, rr_write_mark_head + 1);
+}
+
+static void *rr_writer_thread_fn(void *opaque) {
+    uint64_t tail = rr_writebuf_tail;
+    unsigned mark = rr_write_mark_tail;
+    while (true) {
+        // Read stop first: once it is set, both heads are final. Marks are
+        // read before the bytes so that the bytes before a mark are there.
+        bool stop = atomic_load_acquire(&rr_writer_stop);
+        unsigned marks = atomic_load_acquire(&rr_write_mark_head);
+        uint64_t head = atomic_load_acquire(&rr_writebuf_head);
+        if (tail == head && mark == marks) {
+            if (stop) break;
+            qemu_event_reset(&rr_writebuf_not_empty);
+            if (atomic_load_acquire(&rr_writebuf_head) == tail &&
+                atomic_load_acquire(&rr_write_mark_head) == mark &&
+                !atomic_read(&rr_writer_stop)) {
+                qemu_event_wait(&rr_writebuf_not_empty);
+            }
+            continue;
+        }
+
+        // Write up to the start of the next entry, if there is one.
+        uint64_t end = head;
+        if (mark != marks) {
+            end = MIN(end, rr_write_marks[mark % RR_WRITE_MARKS_LEN].pos);
+        }
+        while (tail != end) {
+            uint64_t off = tail % RR_WRITEBUF_SIZE;
+            uint64_t n = MIN(end - tail, RR_WRITEBUF_SIZE - off);
+            rr_log_sink_write(rr_writebuf + off, n);
+            tail += n;
+            atomic_store_release(&rr_writebuf_tail, tail);
+        }
+        if (mark != marks && rr_write_marks[mark % RR_WRITE_MARKS_LEN].pos == tail) {
+            rr_log_sink_end_entry();
+            rr_block_writer_begin_entry(rr_nondet_log->writer,
+                    rr_write_marks[mark % RR_WRITE_MARKS_LEN].instr_count);
+            mark++;
+            atomic_store_release(&rr_write_mark_tail, mark);
+        }
+        qemu_event_set(&rr_writebuf_not_full);
+    }
+    if (rr_nondet_log->writer) {
+        rr_log_sink_end_entry();
+    }
+    return NULL;
+}
+
+static void rr_writer_start(void) {
+    rr_assert(!rr_writer_running);
+    if (!rr_writebuf) {
+        rr_writebuf = g_malloc(RR_WRITEBUF_SIZE);
+        rr_write_marks = g_new(RR_write_mark, RR_WRITE_MARKS_LEN);
+        qemu_event_init(&rr_writebuf_not_empty, false);
+        qemu_event_init(&rr_writebuf_not_full, false);
+    }
+    rr_writebuf_head = rr_writebuf_tail = 0;
+    rr_write_mark_head = rr_write_mark_tail = 0;
+    rr_writer_stop = false;
+    rr_writer_stalls = 0;
+    qemu_thread_create(&rr_writer_thread, "rr-writer",
+                       rr_writer_thread_fn, NULL, QEMU_THREAD_JOINABLE);
+    rr_writer_running = true;
+}
+
+// Wait for the writer thread to write out everything recorded so far.
+static void rr_writer_stop_thread(void) {
+    if (!rr_writer_running) return;
+    atomic_store_release(&rr_writer_stop, true);
+    qemu_event_set(&rr_writebuf_not_empty);
+    qemu_thread_join(&rr_writer_thread);
+    rr_writer_running = false;
+    if (rr_writer_stalls > 0) {
+        printf("rr: waited %" PRIu64 " times for the nondet log writer\n",
+               rr_writer_stalls);
+    }
+}
+
 static inline size_t rr_fwrite(void *ptr, size_t size, size_t nmemb) {
-    size_t result = fwrite(ptr, size, nmemb, rr_nondet_log->fp);
-    rr_assert(result == nmemb);
-    return result;
+    if (rr_writer_running) {
+        rr_writebuf_put(ptr, size * nmemb);
+        return nmemb;
+    }
+    rr_log_sink_write(ptr, size * nmemb);
+    rr_assert(!rr_writer_failed);
+    return nmemb;
 }
 
 // mz write the current log item to file
@@ -274,8 +457,12 @@ static inline void rr_write_item(RR_log_entry item)
     // mz save the header
     if (!rr_in_record()) return;
     rr_assert(rr_nondet_log != NULL);
+    rr_assert(!atomic_read(&rr_writer_failed));
 
 #define RR_WRITE_ITEM(field) rr_fwrite(&(field), sizeof(field), 1)
+    if (rr_nondet_log->writer) {
+        rr_writebuf_mark(item.header.prog_point.guest_instr_count);
+    }
     // keep replay format the same.
     RR_WRITE_ITEM(item.header.prog_point.guest_instr_count);
     rr_fwrite(&(item.header.kind), 1, 1);
@@ -369,6 +556,7 @@ static inline void rr_write_item(RR_log_entry item)
             // mz unimplemented
             rr_assert(0 && "Unimplemented replay log entry!");
     }
+    qemu_event_set(&rr_writebuf_not_empty);
 }
 
 static inline RR_header rr_header(RR_log_entry_kind kind,
@@ -663,27 +851,91 @@ static inline void rr_record_end_of_log(void) {
 /* REPLAY */
 /******************************************************************************************/
 
+/******************************************************************************************/
+/* READ-AHEAD */
+/******************************************************************************************/
+// The replay log is decoded by a background thread into a single-producer,
+// single-consumer ring of entries, so the vCPU thread never blocks on fread
+// or g_malloc in rr_fill_queue(). Variable-length buffers (DMA, packets,
+// register writes) are carved from a byte arena which is released in FIFO
+// order as the vCPU thread pops entries off rr_queue.
+
+#define RR_READAHEAD_LEN 16384 // must be a power of 2
+#define RR_ARENA_SIZE (64 << 20)
+
+typedef struct {
+    RR_log_entry entry;
+    uint64_t end_pos; // log offset just past this entry
+} RR_readahead_slot;
+
+static RR_readahead_slot rr_readahead[RR_READAHEAD_LEN];
+// Free-running indices: head is only written by the vCPU thread, tail only
+// by the reader thread.
+static unsigned rr_readahead_head;
+static unsigned rr_readahead_tail;
+static QemuEvent rr_readahead_not_empty;
+static QemuEvent rr_readahead_not_full;
+static QemuThread rr_readahead_thread;
+static bool rr_readahead_running = false;
+static bool rr_readahead_stop;
+// Decoder's position in the log file. Owned by the reader thread while it
+// is running.
+static uint64_t rr_readahead_pos;
+
+static uint8_t *rr_arena;
+static uint64_t rr_arena_alloc_pos; // reader thread
+static uint64_t rr_arena_free_pos;  // vCPU thread
+
+// Allocate a buffer for an entry being decoded. Falls back to the heap if
+// the arena is exhausted so that the decoder never waits on the vCPU thread
+// to pop entries it has not been handed yet.
+static void *rr_arena_alloc(RR_skipped_call_args *args, size_t len)
+{
+    uint64_t start = rr_arena_alloc_pos;
+    uint64_t off = start % RR_ARENA_SIZE;
+    if (off + len > RR_ARENA_SIZE) {
+        start += RR_ARENA_SIZE - off; // buffers never wrap around
+    }
+    if (len > RR_ARENA_SIZE ||
+        start + len - atomic_load_acquire(&rr_arena_free_pos) > RR_ARENA_SIZE) {
+        return g_malloc(len);
+    }
+    rr_arena_alloc_pos = start + len;
+    args->arena_pos = rr_arena_alloc_pos;
+    return rr_arena + (start % RR_ARENA_SIZE);
+}
+
+static inline void rr_arena_free(RR_skipped_call_args *args, uint8_t *buf)
+{
+    if (buf >= rr_arena && buf < rr_arena + RR_ARENA_SIZE) {
+        atomic_store_release(&rr_arena_free_pos, args->arena_pos);
+    } else {
+        g_free(buf);
+    }
+}
+
 static inline void free_entry_params(RR_log_entry* entry)
 {
+    RR_skipped_call_args *args = &entry->variant.call_args;
     // mz cleanup associated resources
     switch (entry->header.kind) {
     case RR_SKIPPED_CALL:
-        switch (entry->variant.call_args.kind) {
+        switch (args->kind) {
         case RR_CALL_CPU_MEM_RW:
-            g_free(entry->variant.call_args.variant.cpu_mem_rw_args.buf);
-            entry->variant.call_args.variant.cpu_mem_rw_args.buf = NULL;
+            rr_arena_free(args, args->variant.cpu_mem_rw_args.buf);
+            args->variant.cpu_mem_rw_args.buf = NULL;
             break;
         case RR_CALL_CPU_MEM_UNMAP:
-            g_free(entry->variant.call_args.variant.cpu_mem_unmap.buf);
-            entry->variant.call_args.variant.cpu_mem_unmap.buf = NULL;
+            rr_arena_free(args, args->variant.cpu_mem_unmap.buf);
+            args->variant.cpu_mem_unmap.buf = NULL;
             break;
         case RR_CALL_CPU_REG_WRITE:
-            g_free(entry->variant.call_args.variant.cpu_reg_write_args.buf);
-            entry->variant.call_args.variant.cpu_reg_write_args.buf = NULL;
+            rr_arena_free(args, args->variant.cpu_reg_write_args.buf);
+            args->variant.cpu_reg_write_args.buf = NULL;
             break;
         case RR_CALL_HANDLE_PACKET:
-            g_free(entry->variant.call_args.variant.handle_packet_args.buf);
-            entry->variant.call_args.variant.handle_packet_args.buf = NULL;
+            rr_arena_free(args, args->variant.handle_packet_args.buf);
+            args->variant.handle_packet_args.buf = NULL;
             break;
         default: break;
         }
@@ -699,8 +951,15 @@ static inline void free_entry_params(RR_log_entry* entry)
 }
 
 static inline size_t rr_fread(void *ptr, size_t size, size_t nmemb) {
-    size_t result = fread(ptr, size, nmemb, rr_nondet_log->fp);
-    rr_nondet_log->bytes_read += nmemb * size;
+    size_t result;
+    if (rr_nondet_log->reader) {
+        size_t len = size * nmemb;
+        result = rr_block_reader_read(rr_nondet_log->reader, ptr, len) == len
+            ? nmemb : 0;
+    } else {
+        result = fread(ptr, size, nmemb, rr_nondet_log->fp);
+    }
+    rr_readahead_pos += nmemb * size;
     rr_assert(result == nmemb);
     return result;
 }
@@ -743,6 +1002,9 @@ static inline void rr_queue_pop_front(void) {
     free_entry_params(rr_queue_head);
     if (rr_queue_head == rr_queue_tail) { // only 1 item.
         rr_queue_head = rr_queue_tail = NULL;
+        // we don't know where the next interrupt is until the queue is
+        // refilled, so stop chained TBs until cpu_exec does that.
+        rr_update_chain_limit();
     } else {
         rr_queue_head++;
         if (rr_queue_head == rr_queue_end) {
@@ -751,16 +1013,12 @@ static inline void rr_queue_pop_front(void) {
     }
 }
 
-// Add an entry to the back of the queue.
-// Returns pointer to item just read.
-static RR_log_entry *rr_read_item(void) {
-    RR_log_entry *item = rr_queue_alloc_back();
-
-    rr_assert(rr_in_replay());
-    rr_assert(!rr_log_is_empty());
+// Decode the next entry from the log file into item.
+// Runs on the read-ahead thread.
+static void rr_decode_item(RR_log_entry *item) {
     rr_assert(rr_nondet_log->fp != NULL);
 
-    item->header.file_pos = rr_nondet_log->bytes_read;
+    item->header.file_pos = rr_readahead_pos;
 
 #define RR_READ_ITEM(field) rr_fread(&(field), sizeof(field), 1)
     // mz read header
@@ -802,7 +1060,7 @@ static RR_log_entry *rr_read_item(void) {
                     RR_READ_ITEM(args->variant.cpu_mem_rw_args);
                     // mz buffer length in args->variant.cpu_mem_rw_args.len
                     args->variant.cpu_mem_rw_args.buf =
-                        g_malloc(args->variant.cpu_mem_rw_args.len);
+                        rr_arena_alloc(args, args->variant.cpu_mem_rw_args.len);
                     // mz read the buffer
                     rr_fread(args->variant.cpu_mem_rw_args.buf, 1,
                             args->variant.cpu_mem_rw_args.len);
@@ -810,14 +1068,14 @@ static RR_log_entry *rr_read_item(void) {
                 case RR_CALL_CPU_MEM_UNMAP:
                     RR_READ_ITEM(args->variant.cpu_mem_unmap);
                     args->variant.cpu_mem_unmap.buf =
-                        g_malloc(args->variant.cpu_mem_unmap.len);
+                        rr_arena_alloc(args, args->variant.cpu_mem_unmap.len);
                     rr_fread(args->variant.cpu_mem_unmap.buf, 1,
                                 args->variant.cpu_mem_unmap.len);
                     break;
                 case RR_CALL_CPU_REG_WRITE:
                     RR_READ_ITEM(args->variant.cpu_reg_write_args);
                     args->variant.cpu_reg_write_args.buf =
-                        g_malloc(args->variant.cpu_reg_write_args.len);
+                        rr_arena_alloc(args, args->variant.cpu_reg_write_args.len);
                     rr_fread(args->variant.cpu_reg_write_args.buf, 1,
                                 args->variant.cpu_reg_write_args.len);
                     break;
@@ -844,7 +1102,7 @@ static RR_log_entry *rr_read_item(void) {
                     // mz always allocate a new one. we free it when the item is added
                     // to the recycle list
                     args->variant.handle_packet_args.buf =
-                        g_malloc(args->variant.handle_packet_args.size);
+                        rr_arena_alloc(args, args->variant.handle_packet_args.size);
                     // mz read the buffer
                     rr_fread(args->variant.handle_packet_args.buf,
                             args->variant.handle_packet_args.size, 1);
@@ -873,6 +1131,81 @@ static RR_log_entry *rr_read_item(void) {
             // mz unimplemented
             rr_assert(0 && "Unimplemented replay log entry!");
     }
+}
+
+static void *rr_readahead_thread_fn(void *opaque) {
+    while (rr_readahead_pos < rr_nondet_log->size) {
+        unsigned tail = rr_readahead_tail;
+        while (tail - atomic_load_acquire(&rr_readahead_head) == RR_READAHEAD_LEN) {
+            qemu_event_reset(&rr_readahead_not_full);
+            if (atomic_read(&rr_readahead_stop)) return NULL;
+            if (tail - atomic_load_acquire(&rr_readahead_head) < RR_READAHEAD_LEN) break;
+            qemu_event_wait(&rr_readahead_not_full);
+        }
+        if (atomic_read(&rr_readahead_stop)) return NULL;
+
+        RR_readahead_slot *slot = &rr_readahead[tail % RR_READAHEAD_LEN];
+        memset(&slot->entry, 0, sizeof(slot->entry));
+        rr_decode_item(&slot->entry);
+        slot->end_pos = rr_readahead_pos;
+
+        atomic_store_release(&rr_readahead_tail, tail + 1);
+        qemu_event_set(&rr_readahead_not_empty);
+    }
+    return NULL;
+}
+
+static void rr_readahead_start(void) {
+    rr_assert(!rr_readahead_running);
+    if (!rr_arena) {
+        rr_arena = g_malloc(RR_ARENA_SIZE);
+        qemu_event_init(&rr_readahead_not_empty, false);
+        qemu_event_init(&rr_readahead_not_full, false);
+    }
+    rr_readahead_head = rr_readahead_tail = 0;
+    rr_arena_alloc_pos = rr_arena_free_pos = 0;
+    rr_readahead_pos = rr_nondet_log->bytes_read;
+    rr_readahead_stop = false;
+    qemu_thread_create(&rr_readahead_thread, "rr-readahead",
+                       rr_readahead_thread_fn, NULL, QEMU_THREAD_JOINABLE);
+    rr_readahead_running = true;
+}
+
+// Stop the reader thread and free everything it decoded but the vCPU thread
+// has not consumed.
+static void rr_readahead_stop_thread(void) {
+    if (!rr_readahead_running) return;
+    atomic_set(&rr_readahead_stop, true);
+    qemu_event_set(&rr_readahead_not_full);
+    qemu_thread_join(&rr_readahead_thread);
+    rr_readahead_running = false;
+
+    while (rr_readahead_head != rr_readahead_tail) {
+        free_entry_params(&rr_readahead[rr_readahead_head % RR_READAHEAD_LEN].entry);
+        rr_readahead_head++;
+    }
+}
+
+// Add an entry to the back of the queue.
+// Returns pointer to item just read.
+static RR_log_entry *rr_read_item(void) {
+    RR_log_entry *item = rr_queue_alloc_back();
+
+    rr_assert(rr_in_replay());
+    rr_assert(!rr_log_is_empty());
+    rr_assert(rr_readahead_running);
+
+    unsigned head = rr_readahead_head;
+    while (atomic_load_acquire(&rr_readahead_tail) == head) {
+        qemu_event_reset(&rr_readahead_not_empty);
+        if (atomic_load_acquire(&rr_readahead_tail) != head) break;
+        qemu_event_wait(&rr_readahead_not_empty);
+    }
+    RR_readahead_slot *slot = &rr_readahead[head % RR_READAHEAD_LEN];
+    *item = slot->entry;
+    rr_nondet_log->bytes_read = slot->end_pos;
+    atomic_store_release(&rr_readahead_head, head + 1);
+    qemu_event_set(&rr_readahead_not_full);
 
     // mz let's do some counting
     rr_size_of_log_entries[item->header.kind] +=
@@ -882,6 +1215,45 @@ static RR_log_entry *rr_read_item(void) {
     return item;
 }
 
+void rr_nondet_log_seek(uint64_t pos) {
+    rr_readahead_stop_thread();
+    while (!rr_queue_empty()) {
+        rr_queue_pop_front();
+    }
+    if (rr_nondet_log->reader) {
+        rr_block_reader_seek(rr_nondet_log->reader, pos);
+    } else {
+        fseek(rr_nondet_log->fp, pos, SEEK_SET);
+    }
+    rr_nondet_log->bytes_read = pos;
+    rr_readahead_start();
+}
+
+// Called in a child created by fork() during replay. The reader thread did
+// not survive, and the log's FILE, its lock and its file offset are still
+// shared with the parent, so leave them alone and read from a fresh handle.
+void rr_nondet_log_reopen_after_fork(void) {
+    if (rr_readahead_running) {
+        rr_readahead_running = false;
+        unsigned tail = atomic_read(&rr_readahead_tail);
+        while (rr_readahead_head != tail) {
+            free_entry_params(&rr_readahead[rr_readahead_head % RR_READAHEAD_LEN].entry);
+            rr_readahead_head++;
+        }
+    }
+
+    rr_nondet_log->fp = fopen(rr_nondet_log->name, "r");
+    rr_assert(rr_nondet_log->fp != NULL);
+    if (rr_nondet_log->reader) {
+        // The thread may have died halfway through loading a block.
+        rr_nondet_log->reader = g_new0(RR_block_reader, 1);
+        rr_assert(rr_block_reader_init(rr_nondet_log->reader,
+                                       rr_nondet_log->fp));
+    }
+    rr_nondet_log_seek(rr_queue_head ? rr_queue_head->header.file_pos
+                                     : rr_nondet_log->bytes_read);
+}
+
 // mz fill the queue of log entries from the file
 void rr_fill_queue(void) {
     unsigned long long num_entries = 0;
@@ -907,6 +1279,23 @@ void rr_fill_queue(void) {
     if (num_entries > rr_max_num_queue_entries) {
         rr_max_num_queue_entries = num_entries;
     }
+
+    // Only the tail can be an interrupt, so chained TBs may run up to it.
+    rr_update_chain_limit();
+}
+
+// Chained TBs only return to cpu_exec, which delivers interrupts and
+// checks rr_replay_finished, once they would run past rr_chain_limit. Keep
+// it at the next interrupt or the replay stop point, whichever is first;
+// call this whenever the queue tail or rr_replay_stop_instr_count changes.
+void rr_update_chain_limit(void)
+{
+    // an empty queue has to be refilled by cpu_exec first
+    uint64_t limit = rr_queue_tail ? rr_next_interrupt_instr_count() : 0;
+    if (rr_replay_stop_instr_count && rr_replay_stop_instr_count < limit) {
+        limit = rr_replay_stop_instr_count;
+    }
+    first_cpu->rr_chain_limit = limit;
 }
 
 // Makes sure queue is full and returns fron entry.
@@ -1215,6 +1604,15 @@ void rr_create_record_log(const char* filename)
     if (rr_debug_whisper()) {
         qemu_log("opened %s for write.\n", rr_nondet_log->name);
     }
+    rr_writer_failed = false;
+    if (rr_log_compress) {
+        // v2 keeps the last program point in its own header.
+        rr_nondet_log->writer = g_new0(RR_block_writer, 1);
+        rr_assert(rr_block_writer_init(rr_nondet_log->writer,
+                                       rr_nondet_log->fp));
+        rr_writer_start();
+        return;
+    }
     // mz It would be very handy to know how "far" we are in a particular replay
     // execution.  To do this, let's store a header in the log (we'll fill it in
     // again when we close the log) that includes the maximum instruction
@@ -1224,6 +1622,7 @@ void rr_create_record_log(const char* filename)
     //(as that can jump //sporadically).
     rr_fwrite(&(rr_nondet_log->last_prog_point.guest_instr_count),
             sizeof(rr_nondet_log->last_prog_point.guest_instr_count), 1);
+    rr_writer_start();
 }
 
 // create replay log
@@ -1239,6 +1638,29 @@ void rr_create_replay_log(const char* filename)
     rr_nondet_log->fp = fopen(rr_nondet_log->name, "r");
     rr_assert(rr_nondet_log->fp != NULL);
 
+    if (rr_log_is_v2(rr_nondet_log->fp)) {
+        rr_nondet_log->reader = g_new0(RR_block_reader, 1);
+        rr_assert(rr_block_reader_init(rr_nondet_log->reader,
+                                       rr_nondet_log->fp));
+        RR_log_v2_header *hdr = &rr_nondet_log->reader->header;
+        rr_nondet_log->size = hdr->stream_size;
+        rr_nondet_log->bytes_read = 0;
+        rr_nondet_log->last_prog_point.guest_instr_count = hdr->last_instr_count;
+        if (rr_nondet_log->reader->recovered && (!rr_replay_stop_instr_count
+                    || rr_replay_stop_instr_count > hdr->last_instr_count)) {
+            // No end of log entry: stop before running out of entries.
+            rr_replay_stop_instr_count = hdr->last_instr_count;
+            rr_update_chain_limit();
+        }
+        if (rr_debug_whisper()) {
+            qemu_log("opened %s for read.  v2, %" PRIu64 " blocks, "
+                     "len=%llu bytes uncompressed.\n", rr_nondet_log->name,
+                     hdr->num_blocks, rr_nondet_log->size);
+        }
+        rr_readahead_start();
+        return;
+    }
+
     // mz fill in log size
     stat(rr_nondet_log->name, &statbuf);
     rr_nondet_log->size = statbuf.st_size;
@@ -1248,23 +1670,49 @@ void rr_create_replay_log(const char* filename)
                  rr_nondet_log->size);
     }
     // mz read the last program point from the log header.
+    rr_readahead_pos = 0;
     rr_fread(&(rr_nondet_log->last_prog_point.guest_instr_count),
             sizeof(rr_nondet_log->last_prog_point.guest_instr_count), 1);
+    rr_nondet_log->bytes_read = rr_readahead_pos;
+    rr_readahead_start();
 }
 
 // close file and free associated memory
 void rr_destroy_log(void)
 {
+    if (rr_nondet_log->type == REPLAY) {
+        rr_readahead_stop_thread();
+    } else {
+        rr_writer_stop_thread();
+    }
     if (rr_nondet_log->fp) {
         // mz if in record, update the header with the last written prog point.
-        if (rr_nondet_log->type == RECORD) {
+        if (rr_nondet_log->writer) {
+            if (!rr_block_writer_finish(rr_nondet_log->writer,
+                    rr_nondet_log->last_prog_point.guest_instr_count)) {
+                rr_writer_failed = true;
+            }
+        } else if (rr_nondet_log->type == RECORD) {
             rewind(rr_nondet_log->fp);
             rr_fwrite(&(rr_nondet_log->last_prog_point.guest_instr_count),
                     sizeof(rr_nondet_log->last_prog_point.guest_instr_count), 1);
         }
+        // The recording is only complete once the log is on disk.
+        if (rr_nondet_log->type == RECORD &&
+            (fflush(rr_nondet_log->fp) != 0 ||
+             fsync(fileno(rr_nondet_log->fp)) != 0)) {
+            fprintf(stderr, "rr: error writing %s: %s\n", rr_nondet_log->name,
+                    strerror(errno));
+            rr_writer_failed = true;
+        }
         fclose(rr_nondet_log->fp);
         rr_nondet_log->fp = NULL;
     }
+    if (rr_nondet_log->reader) {
+        rr_block_reader_destroy(rr_nondet_log->reader);
+    }
+    g_free(rr_nondet_log->reader);
+    g_free(rr_nondet_log->writer);
     g_free(rr_nondet_log->name);
     g_free(rr_nondet_log);
     rr_nondet_log = NULL;
@@ -1434,6 +1882,8 @@ void hmp_end_replay(Monitor* mon, const QDict* qdict)
 #endif // CONFIG_SOFTMMU
 
 static time_t rr_start_time;
+// Start snapshot of the current recording, removed if it cannot be written.
+static char *rr_record_snapshot_file;
 
 // mz file_name_full should be full path to desired record/replay log file
 int rr_do_begin_record(const char* file_name_full, CPUState* cpu_state)
@@ -1463,11 +1913,9 @@ int rr_do_begin_record(const char* file_name_full, CPUState* cpu_state)
         global_state_store_running();
         rr_get_snapshot_file_name(rr_name, rr_path, name_buf, sizeof(name_buf));
         printf("writing snapshot:\t%s\n", name_buf);
-        QIOChannelFile* ioc =
-            qio_channel_file_new_path(name_buf, O_WRONLY | O_CREAT, 0660, NULL);
-        QEMUFile* snp = qemu_fopen_channel_output(QIO_CHANNEL(ioc));
-        snapshot_ret = qemu_savevm_state(snp, NULL);
-        qemu_fclose(snp);
+        g_free(rr_record_snapshot_file);
+        rr_record_snapshot_file = g_strdup(name_buf);
+        snapshot_ret = rr_snapshot_save(name_buf, rr_snapshot_background);
         // log_all_cpu_states();
     }
 
@@ -1513,6 +1961,19 @@ void rr_do_end_record(void)
     // log_all_cpu_states();
 
     rr_destroy_log();
+    if (rr_writer_failed) {
+        fprintf(stderr, "rr: failed to write the nondet log of %s; the "
+                "recording is incomplete\n", rr_name);
+    }
+    // A background snapshot has to be complete before anyone replays. If it
+    // failed, remove it so that nobody replays from a partial snapshot.
+    if (rr_snapshot_wait() < 0 && rr_record_snapshot_file) {
+        unlink(rr_record_snapshot_file);
+        fprintf(stderr, "rr: removed incomplete snapshot %s\n",
+                rr_record_snapshot_file);
+    }
+    g_free(rr_record_snapshot_file);
+    rr_record_snapshot_file = NULL;
 
     g_free(rr_path_base);
     g_free(rr_name_base);
@@ -1545,20 +2006,15 @@ int rr_do_begin_replay(const char* file_name_full, CPUState* cpu_state)
         qemu_log("reading snapshot:\t%s\n", name_buf);
     }
     printf("loading snapshot\n");
-    QIOChannelFile* ioc =
-        qio_channel_file_new_path(name_buf, O_RDONLY, 0, NULL);
-    if (ioc == NULL) {
+    if (access(name_buf, R_OK) != 0) {
         printf ("... snapshot file doesn't exist?\n");
         abort();
     }
-    QEMUFile* snp = qemu_fopen_channel_input(QIO_CHANNEL(ioc));
 
     qemu_system_reset(VMRESET_SILENT);
-    MigrationIncomingState* mis = migration_incoming_get_current();
-    mis->from_src_file = snp;
-    snapshot_ret = qemu_loadvm_state(snp);
-    qemu_fclose(snp);
-    migration_incoming_state_destroy();
+    // Guest RAM is mapped from the snapshot, not read, so this takes about
+    // the same time whatever the size of guest memory.
+    snapshot_ret = rr_snapshot_load(name_buf);
 
     if (snapshot_ret < 0) {
         fprintf(stderr, "Failed to load vmstate\n");
@@ -1640,6 +2096,8 @@ void rr_do_end_replay(int is_error)
     rr_destroy_log();
     // turn off replay
     rr_mode = RR_OFF;
+    // TBs translated during replay still check this (CF_RR_CHAIN_CHECK)
+    first_cpu->rr_chain_limit = UINT64_MAX;
 
     rr_replay_complete = true;
     
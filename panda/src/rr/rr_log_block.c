@@ -0,0 +1,329 @@
+/*
+ * Block-compressed, indexed nondet log (v2) reader and writer.
+ *
+ * This file is linked both into the emulator and into the standalone
+ * rr_print tool, so it must not depend on anything but libc, glib and zlib.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <glib.h>
+#include <zlib.h>
+
+#include "panda/rr/rr_log_block.h"
+
+/******************************************************************************************/
+/* WRITER */
+/******************************************************************************************/
+
+bool rr_block_writer_init(RR_block_writer *w, FILE *fp)
+{
+    memset(w, 0, sizeof(*w));
+    w->fp = fp;
+    w->buf_cap = 2 * RR_LOG_BLOCK_SIZE;
+    w->buf = g_malloc(w->buf_cap);
+
+    // placeholder; filled in by rr_block_writer_finish.
+    RR_log_v2_header header = {
+        .magic = RR_LOG_V2_MAGIC,
+        .version = RR_LOG_V2_VERSION,
+        .block_size = RR_LOG_BLOCK_SIZE,
+    };
+    return fwrite(&header, sizeof(header), 1, w->fp) == 1;
+}
+
+static bool rr_block_writer_flush(RR_block_writer *w)
+{
+    if (w->len == 0) return true;
+
+    uLongf zlen = compressBound(w->len);
+    if (zlen > w->zbuf_len) {
+        w->zbuf = g_realloc(w->zbuf, zlen);
+        w->zbuf_len = zlen;
+    }
+    if (compress2(w->zbuf, &zlen, w->buf, w->len, Z_BEST_SPEED) != Z_OK) {
+        return false;
+    }
+
+    if (w->num_blocks == w->index_cap) {
+        w->index_cap = w->index_cap ? 2 * w->index_cap : 1024;
+        w->index = g_renew(RR_block_index_entry, w->index, w->index_cap);
+    }
+    w->index[w->num_blocks++] = (RR_block_index_entry) {
+        .first_instr_count = w->first_instr_count,
+        .file_offset = ftell(w->fp),
+        .stream_offset = w->stream_offset,
+    };
+
+    uint32_t lens[2] = { zlen, w->len };
+    bool ok = fwrite(lens, sizeof(lens), 1, w->fp) == 1
+        && fwrite(w->zbuf, 1, zlen, w->fp) == zlen;
+
+    w->stream_offset += w->len;
+    w->len = 0;
+    return ok;
+}
+
+void rr_block_writer_begin_entry(RR_block_writer *w, uint64_t instr_count)
+{
+    if (w->len == 0) {
+        w->first_instr_count = instr_count;
+    }
+}
+
+void rr_block_writer_write(RR_block_writer *w, const void *ptr, size_t len)
+{
+    // A single entry may be larger than a block (e.g. a big DMA), in which
+    // case the block simply grows to hold it.
+    if (w->len + len > w->buf_cap) {
+        w->buf_cap = w->len + len;
+        w->buf = g_realloc(w->buf, w->buf_cap);
+    }
+    memcpy(w->buf + w->len, ptr, len);
+    w->len += len;
+}
+
+bool rr_block_writer_end_entry(RR_block_writer *w)
+{
+    if (w->len >= RR_LOG_BLOCK_SIZE) {
+        return rr_block_writer_flush(w);
+    }
+    return true;
+}
+
+bool rr_block_writer_finish(RR_block_writer *w, uint64_t last_instr_count)
+{
+    bool ok = rr_block_writer_flush(w);
+
+    RR_log_v2_header header = {
+        .magic = RR_LOG_V2_MAGIC,
+        .version = RR_LOG_V2_VERSION,
+        .block_size = RR_LOG_BLOCK_SIZE,
+        .last_instr_count = last_instr_count,
+        .index_offset = ftell(w->fp),
+        .num_blocks = w->num_blocks,
+        .stream_size = w->stream_offset,
+    };
+    ok = ok && fwrite(w->index, sizeof(RR_block_index_entry), w->num_blocks,
+                      w->fp) == w->num_blocks;
+    // Only point the header at the index once the index is complete.
+    rewind(w->fp);
+    ok = ok && fwrite(&header, sizeof(header), 1, w->fp) == 1;
+
+    g_free(w->buf);
+    g_free(w->zbuf);
+    g_free(w->index);
+    memset(w, 0, sizeof(*w));
+    return ok;
+}
+
+/******************************************************************************************/
+/* READER */
+/******************************************************************************************/
+
+bool rr_log_is_v2(FILE *fp)
+{
+    uint64_t magic = 0;
+    rewind(fp);
+    bool is_v2 = fread(&magic, sizeof(magic), 1, fp) == 1
+        && magic == RR_LOG_V2_MAGIC;
+    rewind(fp);
+    return is_v2;
+}
+
+// Rebuild the index of a log whose recording did not finish by scanning
+// its blocks, up to the first one that is incomplete. Every block starts
+// with a whole entry, and every entry with its instruction count.
+static bool rr_block_reader_rebuild_index(RR_block_reader *r)
+{
+    uint64_t cap = 0;
+    uint64_t file_offset = sizeof(r->header);
+    uint64_t stream_offset = 0;
+    uint32_t lens[2];
+
+    r->header.num_blocks = 0;
+    fseek(r->fp, file_offset, SEEK_SET);
+    while (fread(lens, sizeof(lens), 1, r->fp) == 1) {
+        if (lens[0] > r->zbuf_len) {
+            r->zbuf = g_realloc(r->zbuf, lens[0]);
+            r->zbuf_len = lens[0];
+        }
+        r->buf = g_realloc(r->buf, lens[1]);
+        uLongf rawlen = lens[1];
+        if (fread(r->zbuf, 1, lens[0], r->fp) != lens[0]
+                || uncompress(r->buf, &rawlen, r->zbuf, lens[0]) != Z_OK
+                || rawlen != lens[1] || rawlen < sizeof(uint64_t)) {
+            break;
+        }
+
+        if (r->header.num_blocks == cap) {
+            cap = cap ? 2 * cap : 1024;
+            r->index = g_renew(RR_block_index_entry, r->index, cap);
+        }
+        RR_block_index_entry *entry = &r->index[r->header.num_blocks++];
+        memcpy(&entry->first_instr_count, r->buf, sizeof(uint64_t));
+        entry->file_offset = file_offset;
+        entry->stream_offset = stream_offset;
+
+        file_offset += sizeof(lens) + lens[0];
+        stream_offset += rawlen;
+    }
+
+    if (r->header.num_blocks == 0) {
+        fprintf(stderr, "rr: no complete block in v2 log\n");
+        return false;
+    }
+    r->header.stream_size = stream_offset;
+    // The best known bound without parsing entries: the replay ends where
+    // the log runs out.
+    r->header.last_instr_count =
+        r->index[r->header.num_blocks - 1].first_instr_count;
+    r->len = r->pos = 0;
+    r->block = 0;
+    r->recovered = true;
+    fprintf(stderr, "rr: recovered %" PRIu64 " blocks, %" PRIu64 " bytes\n",
+            r->header.num_blocks, r->header.stream_size);
+    return true;
+}
+
+bool rr_block_reader_init(RR_block_reader *r, FILE *fp)
+{
+    memset(r, 0, sizeof(*r));
+    r->fp = fp;
+    rewind(fp);
+    if (fread(&r->header, sizeof(r->header), 1, fp) != 1
+            || r->header.magic != RR_LOG_V2_MAGIC
+            || r->header.version != RR_LOG_V2_VERSION) {
+        return false;
+    }
+    // A log whose recording never finished has no index.
+    if (r->header.index_offset == 0) {
+        fprintf(stderr, "rr: v2 log has no block index (truncated recording?), "
+                "rebuilding it\n");
+        return rr_block_reader_rebuild_index(r);
+    }
+
+    r->index = g_new(RR_block_index_entry, r->header.num_blocks);
+    fseek(fp, r->header.index_offset, SEEK_SET);
+    if (fread(r->index, sizeof(RR_block_index_entry), r->header.num_blocks, fp)
+            != r->header.num_blocks) {
+        g_free(r->index);
+        r->index = NULL;
+        return false;
+    }
+    r->block = 0;
+    return true;
+}
+
+// Decompress block number b into r->buf.
+static bool rr_block_reader_load(RR_block_reader *r, uint64_t b)
+{
+    if (b >= r->header.num_blocks) return false;
+
+    uint32_t lens[2];
+    fseek(r->fp, r->index[b].file_offset, SEEK_SET);
+    if (fread(lens, sizeof(lens), 1, r->fp) != 1) return false;
+    if (lens[0] > r->zbuf_len) {
+        r->zbuf = g_realloc(r->zbuf, lens[0]);
+        r->zbuf_len = lens[0];
+    }
+    r->buf = g_realloc(r->buf, lens[1]);
+    if (fread(r->zbuf, 1, lens[0], r->fp) != lens[0]) return false;
+
+    uLongf rawlen = lens[1];
+    if (uncompress(r->buf, &rawlen, r->zbuf, lens[0]) != Z_OK
+            || rawlen != lens[1]) {
+        return false;
+    }
+    r->len = rawlen;
+    r->pos = 0;
+    r->block = b + 1;
+    return true;
+}
+
+size_t rr_block_reader_read(RR_block_reader *r, void *ptr, size_t len)
+{
+    size_t done = 0;
+    while (done < len) {
+        if (r->pos == r->len && !rr_block_reader_load(r, r->block)) {
+            break;
+        }
+        size_t n = MIN(len - done, r->len - r->pos);
+        memcpy((uint8_t *)ptr + done, r->buf + r->pos, n);
+        r->pos += n;
+        done += n;
+    }
+    return done;
+}
+
+void rr_block_reader_skip(RR_block_reader *r, uint64_t len)
+{
+    while (len > 0) {
+        if (r->pos == r->len && !rr_block_reader_load(r, r->block)) {
+            break;
+        }
+        size_t n = MIN(len, r->len - r->pos);
+        r->pos += n;
+        len -= n;
+    }
+}
+
+uint64_t rr_block_reader_tell(RR_block_reader *r)
+{
+    if (r->block == 0) return 0;
+    return r->index[r->block - 1].stream_offset + r->pos;
+}
+
+void rr_block_reader_seek(RR_block_reader *r, uint64_t stream_offset)
+{
+    // last block starting at or before stream_offset
+    uint64_t lo = 0, hi = r->header.num_blocks;
+    while (hi - lo > 1) {
+        uint64_t mid = lo + (hi - lo) / 2;
+        if (r->index[mid].stream_offset <= stream_offset) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    if (r->header.num_blocks == 0 || !rr_block_reader_load(r, lo)) {
+        r->len = r->pos = 0;
+        r->block = r->header.num_blocks;
+        return;
+    }
+    r->pos = MIN(stream_offset - r->index[lo].stream_offset, r->len);
+}
+
+uint64_t rr_block_reader_find_instr(RR_block_reader *r, uint64_t instr_count)
+{
+    // Entries at instr_count may begin in the block before the first one
+    // whose first entry is at instr_count, so step back past all blocks
+    // starting at or after it.
+    uint64_t lo = 0, hi = r->header.num_blocks;
+    while (lo < hi) {
+        uint64_t mid = lo + (hi - lo) / 2;
+        if (r->index[mid].first_instr_count < instr_count) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo > 0) lo--;
+    return r->header.num_blocks ? r->index[lo].stream_offset : 0;
+}
+
+void rr_block_reader_destroy(RR_block_reader *r)
+{
+    g_free(r->index);
+    g_free(r->buf);
+    g_free(r->zbuf);
+    memset(r, 0, sizeof(*r));
+}
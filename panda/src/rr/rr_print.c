@@ -24,9 +24,33 @@ volatile sig_atomic_t rr_skipped_callsite_location = 0;
 //mz the log of non-deterministic events
 RR_log *rr_nondet_log = NULL;
 
+static inline uint64_t log_tell(void) {
+    return rr_nondet_log->reader
+        ? rr_block_reader_tell(rr_nondet_log->reader)
+        : (uint64_t) ftell(rr_nondet_log->fp);
+}
+
+// fread() work-alike that understands block-compressed (v2) logs.
+static size_t log_fread(void *ptr, size_t size, size_t nmemb, FILE *fp) {
+    if (rr_nondet_log->reader) {
+        size_t len = size * nmemb;
+        return rr_block_reader_read(rr_nondet_log->reader, ptr, len) == len
+            ? nmemb : 0;
+    }
+    return fread(ptr, size, nmemb, fp);
+}
+
+static void log_skip(uint64_t len) {
+    if (rr_nondet_log->reader) {
+        rr_block_reader_skip(rr_nondet_log->reader, len);
+    } else {
+        fseek(rr_nondet_log->fp, len, SEEK_CUR);
+    }
+}
+
 static inline uint8_t log_is_empty(void) {
     if ((rr_nondet_log->type == REPLAY) &&
-        (rr_nondet_log->size - ftell(rr_nondet_log->fp) == 0)) {
+        (rr_nondet_log->size - log_tell() == 0)) {
         return 1;
     }
     else {
@@ -176,7 +200,7 @@ static RR_log_entry *rr_read_item(void) {
     assert (rr_nondet_log->fp != NULL);
 
     //mz XXX we assume that the log is not trucated - should probably fix this.
-    if (fread(&(item->header.prog_point.guest_instr_count),
+    if (log_fread(&(item->header.prog_point.guest_instr_count),
                 sizeof(item->header.prog_point.guest_instr_count), 1, rr_nondet_log->fp) != 1) {
         //mz an error occurred
         if (feof(rr_nondet_log->fp)) {
@@ -191,96 +215,95 @@ static RR_log_entry *rr_read_item(void) {
         }
     }
     //mz this is more compact, as it doesn't include extra padding.
-    assert(fread(&(item->header.kind), 1, 1, rr_nondet_log->fp) == 1);
-    assert(fread(&(item->header.callsite_loc), 1, 1, rr_nondet_log->fp) == 1);
+    assert(log_fread(&(item->header.kind), 1, 1, rr_nondet_log->fp) == 1);
+    assert(log_fread(&(item->header.callsite_loc), 1, 1, rr_nondet_log->fp) == 1);
 
     //mz read the rest of the item
     switch (item->header.kind) {
         case RR_INPUT_1:
-            assert(fread(&(item->variant.input_1), sizeof(item->variant.input_1), 1, rr_nondet_log->fp) == 1);
+            assert(log_fread(&(item->variant.input_1), sizeof(item->variant.input_1), 1, rr_nondet_log->fp) == 1);
             break;
         case RR_INPUT_2:
-            assert(fread(&(item->variant.input_2), sizeof(item->variant.input_2), 1, rr_nondet_log->fp) == 1);
+            assert(log_fread(&(item->variant.input_2), sizeof(item->variant.input_2), 1, rr_nondet_log->fp) == 1);
             break;
         case RR_INPUT_4:
-            assert(fread(&(item->variant.input_4), sizeof(item->variant.input_4), 1, rr_nondet_log->fp) == 1);
+            assert(log_fread(&(item->variant.input_4), sizeof(item->variant.input_4), 1, rr_nondet_log->fp) == 1);
             break;
         case RR_INPUT_8:
-            assert(fread(&(item->variant.input_8), sizeof(item->variant.input_8), 1, rr_nondet_log->fp) == 1);
+            assert(log_fread(&(item->variant.input_8), sizeof(item->variant.input_8), 1, rr_nondet_log->fp) == 1);
             break;
         case RR_INTERRUPT_REQUEST:
-            assert(fread(&(item->variant.interrupt_request), sizeof(item->variant.interrupt_request), 1, rr_nondet_log->fp) == 1);
+            assert(log_fread(&(item->variant.interrupt_request), sizeof(item->variant.interrupt_request), 1, rr_nondet_log->fp) == 1);
             break;
         case RR_EXIT_REQUEST:
-            assert(fread(&(item->variant.exit_request), sizeof(item->variant.exit_request), 1, rr_nondet_log->fp) == 1);
+            assert(log_fread(&(item->variant.exit_request), sizeof(item->variant.exit_request), 1, rr_nondet_log->fp) == 1);
             break;
         case RR_PENDING_INTERRUPTS:
-            assert(fread(&(item->variant.pending_interrupts), sizeof(item->variant.pending_interrupts), 1, rr_nondet_log->fp) == 1);
+            assert(log_fread(&(item->variant.pending_interrupts), sizeof(item->variant.pending_interrupts), 1, rr_nondet_log->fp) == 1);
             break;
         case RR_EXCEPTION:
-            assert(fread(&(item->variant.exception_index), sizeof(item->variant.exception_index), 1, rr_nondet_log->fp) == 1);
+            assert(log_fread(&(item->variant.exception_index), sizeof(item->variant.exception_index), 1, rr_nondet_log->fp) == 1);
             break;
         case RR_SKIPPED_CALL:
             {
                 RR_skipped_call_args *args = &item->variant.call_args;
                 //mz read kind first!
-                assert(fread(&(args->kind), 1, 1, rr_nondet_log->fp) == 1);
+                assert(log_fread(&(args->kind), 1, 1, rr_nondet_log->fp) == 1);
                 switch(args->kind) {
                     case RR_CALL_CPU_MEM_RW:
-                        assert(fread(&(args->variant.cpu_mem_rw_args), sizeof(args->variant.cpu_mem_rw_args), 1, rr_nondet_log->fp) == 1);
+                        assert(log_fread(&(args->variant.cpu_mem_rw_args), sizeof(args->variant.cpu_mem_rw_args), 1, rr_nondet_log->fp) == 1);
                         //mz buffer length in args->variant.cpu_mem_rw_args.len
                         //mz always allocate a new one. we free it when the item is added to the recycle list
                         //args->variant.cpu_mem_rw_args.buf = g_malloc(args->variant.cpu_mem_rw_args.len);
                         //mz read the buffer
                         //assert(fread(args->variant.cpu_mem_rw_args.buf, 1, args->variant.cpu_mem_rw_args.len, rr_nondet_log->fp) > 0);
-                        fseek(rr_nondet_log->fp, args->variant.cpu_mem_rw_args.len, SEEK_CUR);
+                        log_skip(args->variant.cpu_mem_rw_args.len);
                         break;
                     case RR_CALL_CPU_MEM_UNMAP:
-                        assert(fread(&(args->variant.cpu_mem_unmap), sizeof(args->variant.cpu_mem_unmap), 1, rr_nondet_log->fp) == 1);
+                        assert(log_fread(&(args->variant.cpu_mem_unmap), sizeof(args->variant.cpu_mem_unmap), 1, rr_nondet_log->fp) == 1);
                         //mz buffer length in args->variant.cpu_mem_unmap.len
                         //mz always allocate a new one. we free it when the item is added to the recycle list
                         //args->variant.cpu_mem_unmap.buf = g_malloc(args->variant.cpu_mem_unmap.len);
                         //mz read the buffer
                         //assert(fread(args->variant.cpu_mem_unmap.buf, 1, args->variant.cpu_mem_unmap.len, rr_nondet_log->fp) > 0);
-                        fseek(rr_nondet_log->fp, args->variant.cpu_mem_unmap.len, SEEK_CUR);
+                        log_skip(args->variant.cpu_mem_unmap.len);
                         break;
                     case RR_CALL_MEM_REGION_CHANGE:
-                        assert(fread(&(args->variant.mem_region_change_args),
+                        assert(log_fread(&(args->variant.mem_region_change_args),
                             sizeof(args->variant.mem_region_change_args), 1,
                             rr_nondet_log->fp) == 1);
-                        fseek(rr_nondet_log->fp, args->variant.mem_region_change_args.len, SEEK_CUR);
+                        log_skip(args->variant.mem_region_change_args.len);
                         break;
                     case RR_CALL_HD_TRANSFER:
-                        assert(fread(&(args->variant.hd_transfer_args),
+                        assert(log_fread(&(args->variant.hd_transfer_args),
                               sizeof(args->variant.hd_transfer_args), 1, rr_nondet_log->fp) == 1);
                         break;
                     case RR_CALL_HANDLE_PACKET:
-                        assert(fread(&(args->variant.handle_packet_args),
+                        assert(log_fread(&(args->variant.handle_packet_args),
                               sizeof(args->variant.handle_packet_args), 1, rr_nondet_log->fp) == 1);
-                        fseek(rr_nondet_log->fp,
-                            args->variant.handle_packet_args.size, SEEK_CUR);
+                        log_skip(args->variant.handle_packet_args.size);
                         break;
                     case RR_CALL_NET_TRANSFER:
-                        assert(fread(&(args->variant.net_transfer_args),
+                        assert(log_fread(&(args->variant.net_transfer_args),
                               sizeof(args->variant.net_transfer_args), 1, rr_nondet_log->fp) == 1);
                         break;
                     case RR_CALL_SERIAL_RECEIVE:
-                        assert(fread(&(args->variant.serial_receive_args),
+                        assert(log_fread(&(args->variant.serial_receive_args),
                                      sizeof(args->variant.serial_receive_args),
                                      1, rr_nondet_log->fp) == 1);
                         break;
                     case RR_CALL_SERIAL_READ:
-                        assert(fread(&(args->variant.serial_read_args),
+                        assert(log_fread(&(args->variant.serial_read_args),
                                      sizeof(args->variant.serial_read_args), 1,
                                      rr_nondet_log->fp) == 1);
                         break;
                     case RR_CALL_SERIAL_SEND:
-                        assert(fread(&(args->variant.serial_send_args),
+                        assert(log_fread(&(args->variant.serial_send_args),
                                      sizeof(args->variant.serial_send_args), 1,
                                      rr_nondet_log->fp) == 1);
                         break;
                     case RR_CALL_SERIAL_WRITE:
-                        assert(fread(&(args->variant.serial_write_args),
+                        assert(log_fread(&(args->variant.serial_write_args),
                                      sizeof(args->variant.serial_write_args), 1,
                                      rr_nondet_log->fp) == 1);
                         break;
@@ -316,6 +339,18 @@ void rr_create_replay_log (const char *filename) {
   rr_nondet_log->fp = fopen(rr_nondet_log->name, "r");
   assert(rr_nondet_log->fp != NULL);
 
+  if (rr_log_is_v2(rr_nondet_log->fp)) {
+    rr_nondet_log->reader = g_new0(RR_block_reader, 1);
+    assert(rr_block_reader_init(rr_nondet_log->reader, rr_nondet_log->fp));
+    rr_nondet_log->size = rr_nondet_log->reader->header.stream_size;
+    rr_nondet_log->last_prog_point.guest_instr_count =
+        rr_nondet_log->reader->header.last_instr_count;
+    fprintf (stdout, "opened %s for read.  v2, %" PRIu64 " blocks, len=%llu bytes uncompressed.\n",
+       rr_nondet_log->name, rr_nondet_log->reader->header.num_blocks,
+       rr_nondet_log->size);
+    return;
+  }
+
   //mz fill in log size
   stat(rr_nondet_log->name, &statbuf);
   rr_nondet_log->size = statbuf.st_size;
@@ -326,11 +361,22 @@ void rr_create_replay_log (const char *filename) {
 }
 
 int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <nondet log> [start instr count]\n", argv[0]);
+        return 1;
+    }
+    uint64_t start = argc > 2 ? strtoull(argv[2], NULL, 0) : 0;
     rr_create_replay_log(argv[1]);
     printf("RR Log with %llu instructions\n", (unsigned long long) rr_nondet_log->last_prog_point.guest_instr_count);
+    if (start && rr_nondet_log->reader) {
+        // jump straight to the block containing start via the index
+        rr_block_reader_seek(rr_nondet_log->reader,
+                rr_block_reader_find_instr(rr_nondet_log->reader, start));
+    }
     RR_log_entry *log_entry = NULL;
     while(!log_is_empty()) {
         log_entry = rr_read_item();
+        if (log_entry->header.prog_point.guest_instr_count < start) continue;
         rr_spit_log_entry(*log_entry);
     }
     if (log_entry) g_free(log_entry);
@@ -0,0 +1,304 @@
+/*
+ * Record/replay start snapshots with memory-mappable guest RAM.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ */
+
+#include "qemu/osdep.h"
+#include "qemu-common.h"
+#include "qemu/cutils.h"
+#include "qemu/rcu.h"
+#include "cpu.h"
+#include "exec/ram_addr.h"
+#include "migration/migration.h"
+#include "migration/qemu-file.h"
+#include "io/channel-file.h"
+#include "sysemu/sysemu.h"
+#include "panda/rr/rr_snapshot.h"
+
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+// Granularity at which all-zero RAM is left out of the file.
+#define RR_SNAPSHOT_CHUNK (1 << 16)
+
+static int rr_snapshot_pwrite(int fd, const uint8_t *buf, uint64_t len,
+                              uint64_t offset)
+{
+    while (len > 0) {
+        ssize_t n = pwrite(fd, buf, len, offset);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return -errno;
+        }
+        buf += n;
+        len -= n;
+        offset += n;
+    }
+    return 0;
+}
+
+static int rr_snapshot_pread(int fd, uint8_t *buf, uint64_t len,
+                             uint64_t offset)
+{
+    while (len > 0) {
+        ssize_t n = pread(fd, buf, len, offset);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return -errno;
+        }
+        if (n == 0) {
+            // Holes at the end of the file read as zeros too.
+            memset(buf, 0, len);
+            return 0;
+        }
+        buf += n;
+        len -= n;
+        offset += n;
+    }
+    return 0;
+}
+
+// Write len bytes of guest RAM at offset, leaving holes for zero chunks.
+static int rr_snapshot_write_ram(int fd, const uint8_t *host, uint64_t len,
+                                 uint64_t offset)
+{
+    for (uint64_t done = 0; done < len; done += RR_SNAPSHOT_CHUNK) {
+        uint64_t n = MIN(RR_SNAPSHOT_CHUNK, len - done);
+        if (buffer_is_zero(host + done, n)) continue;
+        int ret = rr_snapshot_pwrite(fd, host + done, n, offset + done);
+        if (ret < 0) return ret;
+    }
+    return 0;
+}
+
+// Writer process of the last background snapshot, or 0.
+static pid_t rr_snapshot_pid;
+
+// Fork a process that writes the RAM described by blocks as it is right
+// now. The kernel copies each page the guest writes to afterwards, so the
+// child sees a consistent image while recording goes on.
+static pid_t rr_snapshot_fork_writer(int fd, RR_snapshot_block *blocks,
+                                     uint8_t **hosts, uint32_t num_blocks)
+{
+    RAMBlock *block;
+    rcu_read_lock();
+    QLIST_FOREACH_RCU(block, &ram_list.blocks, next) {
+        // Shared memory is not copied on write.
+        if (qemu_ram_is_shared(block)) {
+            rcu_read_unlock();
+            return -1;
+        }
+    }
+    // Guest RAM is normally kept out of children (for KVM's sake).
+#ifdef MADV_DOFORK
+    QLIST_FOREACH_RCU(block, &ram_list.blocks, next) {
+        madvise(block->host, block->max_length, MADV_DOFORK);
+    }
+#endif
+    pid_t pid = fork();
+    if (pid == 0) {
+        // Only async-signal-safe calls from here on.
+        for (uint32_t i = 0; i < num_blocks; i++) {
+            if (rr_snapshot_write_ram(fd, hosts[i], blocks[i].used_length,
+                                      blocks[i].file_offset) < 0) {
+                _exit(1);
+            }
+        }
+        _exit(fdatasync(fd) < 0);
+    }
+    QLIST_FOREACH_RCU(block, &ram_list.blocks, next) {
+        qemu_madvise(block->host, block->max_length, QEMU_MADV_DONTFORK);
+    }
+    rcu_read_unlock();
+    return pid;
+}
+
+int rr_snapshot_wait(void)
+{
+    if (rr_snapshot_pid <= 0) return 0;
+
+    int status;
+    pid_t pid;
+    do {
+        pid = waitpid(rr_snapshot_pid, &status, 0);
+    } while (pid < 0 && errno == EINTR);
+    rr_snapshot_pid = 0;
+    if (pid < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        fprintf(stderr, "rr: background snapshot failed, the recording "
+                "cannot be replayed\n");
+        return -EIO;
+    }
+    return 0;
+}
+
+int rr_snapshot_save(const char *file_name, bool background)
+{
+    // Don't let two writers race on a file of the same name.
+    rr_snapshot_wait();
+
+    int fd = qemu_open(file_name, O_WRONLY | O_CREAT | O_TRUNC, 0660);
+    if (fd < 0) {
+        fprintf(stderr, "rr: could not create snapshot %s: %s\n", file_name,
+                strerror(errno));
+        return -errno;
+    }
+
+    RAMBlock *block;
+    uint32_t num_blocks = 0;
+    int ret = 0;
+
+    rcu_read_lock();
+    QLIST_FOREACH_RCU(block, &ram_list.blocks, next) {
+        num_blocks++;
+    }
+    RR_snapshot_block *blocks = g_new0(RR_snapshot_block, num_blocks);
+    uint8_t **hosts = g_new(uint8_t *, num_blocks);
+    uint64_t offset = ROUND_UP(sizeof(RR_snapshot_header) +
+                               num_blocks * sizeof(RR_snapshot_block),
+                               RR_SNAPSHOT_ALIGN);
+    uint32_t i = 0;
+    QLIST_FOREACH_RCU(block, &ram_list.blocks, next) {
+        pstrcpy(blocks[i].idstr, sizeof(blocks[i].idstr), block->idstr);
+        blocks[i].used_length = block->used_length;
+        blocks[i].file_offset = offset;
+        hosts[i] = block->host;
+        offset = ROUND_UP(offset + block->used_length, RR_SNAPSHOT_ALIGN);
+        i++;
+    }
+    rcu_read_unlock();
+
+    RR_snapshot_header header = {
+        .magic = RR_SNAPSHOT_MAGIC,
+        .version = RR_SNAPSHOT_VERSION,
+        .num_blocks = num_blocks,
+        .state_offset = offset,
+    };
+    ret = rr_snapshot_pwrite(fd, (uint8_t *)&header, sizeof(header), 0);
+    if (ret == 0) {
+        ret = rr_snapshot_pwrite(fd, (uint8_t *)blocks,
+                                 num_blocks * sizeof(RR_snapshot_block),
+                                 sizeof(header));
+    }
+
+    pid_t pid = -1;
+    if (ret == 0 && background) {
+        pid = rr_snapshot_fork_writer(fd, blocks, hosts, num_blocks);
+        if (pid < 0) {
+            fprintf(stderr, "rr: cannot write snapshot in the background, "
+                    "writing it now\n");
+        }
+    }
+    for (i = 0; ret == 0 && pid < 0 && i < num_blocks; i++) {
+        ret = rr_snapshot_write_ram(fd, hosts[i], blocks[i].used_length,
+                                    blocks[i].file_offset);
+    }
+    g_free(blocks);
+    g_free(hosts);
+    if (pid > 0) {
+        rr_snapshot_pid = pid;
+    }
+
+    // The writer only uses pwrite, so the shared file offset is ours.
+    if (ret == 0 && lseek(fd, offset, SEEK_SET) < 0) {
+        ret = -errno;
+    }
+    if (ret < 0) {
+        fprintf(stderr, "rr: error writing snapshot %s: %s\n", file_name,
+                strerror(-ret));
+        close(fd);
+        return ret;
+    }
+
+    // The channel owns fd from here on.
+    QIOChannelFile *ioc = qio_channel_file_new_fd(fd);
+    QEMUFile *f = qemu_fopen_channel_output(QIO_CHANNEL(ioc));
+    object_unref(OBJECT(ioc));
+    ram_state_external = true;
+    ret = qemu_savevm_state(f, NULL);
+    ram_state_external = false;
+    qemu_fclose(f);
+    return ret;
+}
+
+// Map (or, where that is not possible, read) each RAM block from the file.
+static int rr_snapshot_load_ram(int fd, const RR_snapshot_header *header)
+{
+    RR_snapshot_block *blocks = g_new(RR_snapshot_block, header->num_blocks);
+    int ret = rr_snapshot_pread(fd, (uint8_t *)blocks,
+                                header->num_blocks * sizeof(RR_snapshot_block),
+                                sizeof(*header));
+
+    for (uint32_t i = 0; ret == 0 && i < header->num_blocks; i++) {
+        RR_snapshot_block *b = &blocks[i];
+        RAMBlock *block = qemu_ram_block_by_name(b->idstr);
+        if (!block || block->used_length != b->used_length) {
+            fprintf(stderr, "rr: snapshot RAM block %s is missing or has "
+                    "a different size\n", b->idstr);
+            ret = -EINVAL;
+            break;
+        }
+
+        // File-backed RAM (-mem-path) and huge pages keep their own
+        // mapping; everything else is replaced by a private file mapping.
+        if (block->fd < 0 && block->page_size == qemu_real_host_page_size
+                && QEMU_PTR_IS_ALIGNED(block->host, qemu_real_host_page_size)
+                && b->file_offset % qemu_real_host_page_size == 0) {
+            void *p = mmap(block->host, b->used_length, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_FIXED, fd, b->file_offset);
+            if (p != MAP_FAILED) continue;
+        }
+        ret = rr_snapshot_pread(fd, block->host, b->used_length,
+                                b->file_offset);
+    }
+    g_free(blocks);
+    return ret;
+}
+
+int rr_snapshot_load(const char *file_name)
+{
+    int fd = qemu_open(file_name, O_RDONLY);
+    if (fd < 0) {
+        fprintf(stderr, "rr: could not open snapshot %s: %s\n", file_name,
+                strerror(errno));
+        return -errno;
+    }
+
+    RR_snapshot_header header;
+    uint64_t state_offset = 0;
+    if (pread(fd, &header, sizeof(header), 0) == sizeof(header)
+            && header.magic == RR_SNAPSHOT_MAGIC) {
+        int ret = 0;
+        if (header.version != RR_SNAPSHOT_VERSION) {
+            fprintf(stderr, "rr: unsupported snapshot version %u\n",
+                    header.version);
+            ret = -EINVAL;
+        } else {
+            ret = rr_snapshot_load_ram(fd, &header);
+        }
+        if (ret < 0) {
+            close(fd);
+            return ret;
+        }
+        state_offset = header.state_offset;
+    }
+    // Otherwise this is an old snapshot: a savevm stream including RAM.
+    if (lseek(fd, state_offset, SEEK_SET) < 0) {
+        int ret = -errno;
+        close(fd);
+        return ret;
+    }
+
+    QIOChannelFile *ioc = qio_channel_file_new_fd(fd);
+    QEMUFile *f = qemu_fopen_channel_input(QIO_CHANNEL(ioc));
+    object_unref(OBJECT(ioc));
+    MigrationIncomingState *mis = migration_incoming_get_current();
+    mis->from_src_file = f;
+    int ret = qemu_loadvm_state(f);
+    qemu_fclose(f);
+    migration_incoming_state_destroy();
+    return ret;
+}
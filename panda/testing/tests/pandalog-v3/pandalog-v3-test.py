@@ -0,0 +1,45 @@
+#!/usr/bin/python
+
+# write the same pandalog with the zlib and the uncompressed chunk codec
+# and check that both have a v3 header and read back the same entries.
+
+import os
+import sys
+import struct
+from google.protobuf.json_format import MessageToJson
+
+thisdir = os.path.dirname(os.path.realpath(__file__))
+td = os.path.realpath(thisdir + "/../..")
+sys.path.append(td)
+
+from ptest_utils import *
+sys.path.append(pandascriptsdir)
+from plog_reader import PLogReader, PL_CODEC_ZLIB, PL_CODEC_NONE
+
+def dump(plog):
+    with PLogReader(plog) as plr:
+        return [MessageToJson(m) for m in plr]
+
+def header(plog):
+    with open(plog, 'rb') as f:
+        version, _, _, _, codec = struct.unpack('<IIQII', f.read(24))
+    return version, codec
+
+zplog = miscdir + "/netstat-zlib.plog"
+nplog = miscdir + "/netstat-none.plog"
+run_test_debian("-panda asidstory -os linux-32-lava32 -pandalog " + zplog,
+                "netstat", "i386")
+run_test_debian("-panda asidstory -os linux-32-lava32 -pandalog " + nplog +
+                " -pandalog-codec none", "netstat", "i386", clear_tmpout=False)
+
+zentries = dump(zplog)
+nentries = dump(nplog)
+
+with open(tmpoutfile, "w") as f:
+    for msg in ["zlib header: %s" % (header(zplog) == (3, PL_CODEC_ZLIB)),
+                "none header: %s" % (header(nplog) == (3, PL_CODEC_NONE)),
+                "entries: %d" % len(zentries),
+                "same entries: %s" % (zentries == nentries)]:
+        progress(msg)
+        f.write(msg + "\n")
+    f.write("\n".join(zentries) + "\n")
@@ -0,0 +1,12 @@
+#!/usr/bin/python
+
+import os
+import sys
+
+thisdir = os.path.dirname(os.path.realpath(__file__))
+td = os.path.realpath(thisdir + "/../..")
+sys.path.append(td)
+
+from ptest_utils import *
+
+record_debian("guest:/bin/netstat -a", "netstat", "i386")
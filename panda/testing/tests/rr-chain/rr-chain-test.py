@@ -0,0 +1,44 @@
+#!/usr/bin/python
+
+# replay with no plugins, so TBs are chained up to the next interrupt, and
+# with callstack_instr, whose block callbacks turn chaining off. Both must
+# reach the end of the log with the same guest memory.
+
+import os
+import re
+import sys
+import subprocess as sp
+
+thisdir = os.path.dirname(os.path.realpath(__file__))
+td = os.path.realpath(thisdir + "/../..")
+sys.path.append(td)
+
+from ptest_utils import *
+
+arch_data = SUPPORTED_ARCHES["i386"]
+qemu = os.path.join(panda_build_dir, arch_data.dir, arch_data.binary)
+
+def replay(args):
+    progress("Replaying netstat " + " ".join(args))
+    output = sp.check_output([qemu, "-display", "none", "-replay",
+                              replaydir + "/netstat"] + args,
+                             stderr=sp.STDOUT)
+    checksum = re.search(r'Checksum of guest memory: (\S+)', output)
+    return ("Replay completed successfully" in output,
+            checksum.group(1) if checksum else None)
+
+clear_dir(tmpoutdir)
+os.chdir(tmpoutdir)
+results = []
+chained = replay([])
+unchained = replay(["-panda", "callstack_instr"])
+results.append("chained replay: %s" % ("succeeded" if chained[0] else "FAILED"))
+results.append("unchained replay: %s" %
+               ("succeeded" if unchained[0] else "FAILED"))
+results.append("same memory: %s" % (chained[1] is not None and
+                                    chained[1] == unchained[1]))
+
+with open(tmpoutfile, "w") as f:
+    for r in results:
+        progress(r)
+        f.write(r + "\n")
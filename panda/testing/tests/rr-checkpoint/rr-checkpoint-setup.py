@@ -0,0 +1,16 @@
+#!/usr/bin/python
+
+import os
+import sys
+
+thisdir = os.path.dirname(os.path.realpath(__file__))
+td = os.path.realpath(thisdir + "/../..")
+sys.path.append(td)
+
+from ptest_utils import *
+
+record_debian("guest:/bin/cat guest:/etc/passwd", "cat", "i386")
+
+ssf = open(miscdir + "/cat_search_strings.txt", "w")
+ssf.write("Debian User\n")
+ssf.close()
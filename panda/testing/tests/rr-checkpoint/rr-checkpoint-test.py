@@ -0,0 +1,71 @@
+#!/usr/bin/python
+
+# replay with stringsearch alone, then while each kind of checkpoint is
+# being taken, and check that every replay finds the same matches. Finally
+# replay in slices from fork checkpoints with parallel_replay.py and check
+# that the merged pandalog has the same matches as a single full replay.
+
+import os
+import sys
+import subprocess as sp
+
+thisdir = os.path.dirname(os.path.realpath(__file__))
+td = os.path.realpath(thisdir + "/../..")
+sys.path.append(td)
+
+from ptest_utils import *
+sys.path.append(pandascriptsdir)
+from plog_reader import PLogReader
+
+ss_filename = miscdir + "/cat"
+
+def plog_matches(plog):
+    with PLogReader(plog) as plr:
+        return [(m.instr, m.pc, m.string_match.str_idx,
+                 m.string_match.is_write, m.string_match.asid)
+                for m in plr if m.HasField('string_match')]
+
+def replay_matches(args, clear=False):
+    run_test_debian("-panda stringsearch:name=%s %s" % (ss_filename, args),
+                    "cat", "i386", clear_tmpout=clear)
+    with open(ss_filename + "_string_matches.txt") as f:
+        return f.read()
+
+results = []
+plain = replay_matches("", True)
+for desc, args in [("incremental checkpoints",
+                    "-panda checkpoint:incremental=true,max=16"),
+                   ("full checkpoints", "-panda checkpoint:space=1G"),
+                   ("fork checkpoints", "-panda checkpoint:fork=true,max=16")]:
+    try:
+        same = replay_matches(args) == plain
+        results.append("%s: %s" % (desc, "same" if same else "DIFFERENT"))
+    except Exception as e:
+        results.append("%s: FAILED" % desc)
+
+full_plog = miscdir + "/cat-full.plog"
+run_test_debian("-panda stringsearch:name=%s -pandalog %s"
+                % (ss_filename, full_plog), "cat", "i386", clear_tmpout=False)
+full = plog_matches(full_plog)
+results.append("full replay plog matches: %d" % len(full))
+
+arch_data = SUPPORTED_ARCHES["i386"]
+qemu = os.path.join(panda_build_dir, arch_data.dir, arch_data.binary)
+sliced_plog = miscdir + "/cat-sliced.plog"
+try:
+    sp.check_call([sys.executable,
+                   os.path.join(pandascriptsdir, "parallel_replay.py"),
+                   "-j", "2", "-k", "4", "--qemu", qemu,
+                   "--workdir", miscdir + "/slices",
+                   replaydir + "/cat", sliced_plog, "--",
+                   "-panda", "stringsearch:name=" + ss_filename])
+    same = plog_matches(sliced_plog) == full
+    results.append("sliced replay: %s" % ("same" if same else "DIFFERENT"))
+except Exception as e:
+    results.append("sliced replay: FAILED")
+
+with open(tmpoutfile, "w") as f:
+    f.write(plain)
+    for r in results:
+        progress(r)
+        f.write(r + "\n")
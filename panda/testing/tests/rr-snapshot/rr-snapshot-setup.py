@@ -0,0 +1,20 @@
+#!/usr/bin/python
+
+import os
+import sys
+
+thisdir = os.path.dirname(os.path.realpath(__file__))
+td = os.path.realpath(thisdir + "/../..")
+sys.path.append(td)
+
+from ptest_utils import *
+
+record_debian("guest:/bin/cat guest:/etc/passwd", "cat", "i386")
+# start snapshot RAM written by a forked process while recording runs
+record_debian("--qemu_args=-rr-background-snapshot guest:/bin/cat guest:/etc/passwd",
+              "cat_bg", "i386")
+
+for name in ["cat", "cat_bg"]:
+    ssf = open(miscdir + "/%s_search_strings.txt" % name, "w")
+    ssf.write("Debian User\n")
+    ssf.close()
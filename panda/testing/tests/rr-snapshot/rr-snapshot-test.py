@@ -0,0 +1,57 @@
+#!/usr/bin/python
+
+# check that recordings start from a memory-mappable snapshot, that they
+# replay the same way twice, and that a scissors slice, whose snapshot is
+# written in the same format at a later point, replays too.
+
+import os
+import sys
+import struct
+
+thisdir = os.path.dirname(os.path.realpath(__file__))
+td = os.path.realpath(thisdir + "/../..")
+sys.path.append(td)
+
+from ptest_utils import *
+
+RR_SNAPSHOT_MAGIC = 0x31504e5352524450
+
+def snapshot_ok(replayname):
+    with open(replaydir + "/%s-rr-snp" % replayname, 'rb') as f:
+        magic, version = struct.unpack('<QI', f.read(12))
+    return magic == RR_SNAPSHOT_MAGIC and version == 1
+
+def replay_matches(replayname, name, clear=False):
+    ss_filename = miscdir + "/" + name
+    run_test_debian("-panda stringsearch:name=" + ss_filename, replayname,
+                    "i386", clear_tmpout=clear)
+    with open(ss_filename + "_string_matches.txt") as f:
+        return f.read()
+
+results = []
+first = replay_matches("cat", "cat", True)
+for name in ["cat", "cat_bg"]:
+    results.append("%s snapshot format: %s" % (name, snapshot_ok(name)))
+    a = replay_matches(name, name) if name != "cat" else first
+    b = replay_matches(name, name)
+    results.append("%s replay deterministic: %s" % (name, a == b))
+    results.append("%s matches: %s" % (name, a == first))
+
+with open(replaydir + "/cat-rr-nondet.log", 'rb') as f:
+    num_instrs, = struct.unpack("<Q", f.read(8))
+start = num_instrs // 3
+run_test_debian("-panda scissors:name=%s/cat_cut,start=%d,end=%d"
+                % (replaydir, start, num_instrs), "cat", "i386",
+                clear_tmpout=False)
+results.append("slice snapshot format: %s" % snapshot_ok("cat_cut"))
+try:
+    run_test_debian("", "cat_cut", "i386", clear_tmpout=False)
+    results.append("slice replay: succeeded")
+except Exception as e:
+    results.append("slice replay: FAILED")
+
+with open(tmpoutfile, "w") as f:
+    f.write(first)
+    for r in results:
+        progress(r)
+        f.write(r + "\n")
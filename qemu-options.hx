@@ -4163,6 +4163,13 @@ DEF("record-from", HAS_ARG, QEMU_OPTION_record_from,
     "-record-from <snapshot>:<record-name>\n"
     "                load snapshot <snapshot> and begin recording\n", QEMU_ARCH_ALL)
 
+DEF("rr-compress", 0, QEMU_OPTION_rr_compress,
+    "-rr-compress    write block-compressed, indexed nondet logs when recording\n", QEMU_ARCH_ALL)
+
+DEF("rr-background-snapshot", 0, QEMU_OPTION_rr_background_snapshot,
+    "-rr-background-snapshot\n"
+    "                start recording without waiting for guest RAM to be saved\n", QEMU_ARCH_ALL)
+
 DEF("replay", HAS_ARG, QEMU_OPTION_replay,
     "-replay </path/to/snapshot-prefix>\n"
     "                replay the recording that starts at <snapshot>\n", QEMU_ARCH_ALL)
@@ -4171,6 +4178,10 @@ DEF("pandalog", HAS_ARG, QEMU_OPTION_pandalog,
     "-pandalog <filename>\n"
     "                enable panda logging to file\n", QEMU_ARCH_ALL)
 
+DEF("pandalog-codec", HAS_ARG, QEMU_OPTION_pandalog_codec,
+    "-pandalog-codec zlib[:<level>]|none\n"
+    "                how pandalog chunks are compressed (default: zlib:1)\n", QEMU_ARCH_ALL)
+
 DEF("panda-plugin", HAS_ARG, QEMU_OPTION_panda_plugin,
     "-panda-plugin <file>\n"
     "                load PANDA plugin from <file>\n", QEMU_ARCH_ALL)
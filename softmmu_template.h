@@ -105,6 +105,36 @@ static inline DATA_TYPE glue(io_read, SUFFIX)(CPUArchState *env,
 }
 #endif
 
+#ifndef SOFTMMU_CODE_ACCESS
+/* PANDA: report a load from a page holding a watched range to the
+   range-watching memory callbacks around doing it.  */
+static WORD_TYPE glue(helper_le_ld_name, _watched)(CPUArchState *env,
+                                                   target_ulong addr,
+                                                   TCGMemOpIdx oi,
+                                                   uintptr_t retaddr)
+{
+    unsigned mmu_idx = get_mmuidx(oi);
+    int index = (addr >> TARGET_PAGE_BITS) & (CPU_TLB_SIZE - 1);
+    target_ulong tlb_addr = env->tlb_table[mmu_idx][index].addr_read;
+    CPUState *cpu = ENV_GET_CPU(env);
+    uintptr_t haddr = 0;
+    WORD_TYPE res;
+
+    if ((addr & TARGET_PAGE_MASK) == (tlb_addr & ~TLB_PANDA_WATCH)) {
+        haddr = addr + env->tlb_table[mmu_idx][index].addend;
+    }
+
+    panda_callbacks_mem_watch(cpu, false, false, addr, DATA_SIZE, 0,
+                              (void *)haddr);
+    cpu->panda_in_mem_watch = true;
+    res = helper_le_ld_name(env, addr, oi, retaddr);
+    cpu->panda_in_mem_watch = false;
+    panda_callbacks_mem_watch(cpu, false, true, addr, DATA_SIZE, (uint64_t)res,
+                              (void *)haddr);
+    return res;
+}
+#endif
+
 WORD_TYPE helper_le_ld_name(CPUArchState *env, target_ulong addr,
                             TCGMemOpIdx oi, uintptr_t retaddr)
 {
@@ -130,6 +160,16 @@ WORD_TYPE helper_le_ld_name(CPUArchState *env, target_ulong addr,
         tlb_addr = env->tlb_table[mmu_idx][index].ADDR_READ;
     }
 
+#ifndef SOFTMMU_CODE_ACCESS
+    /* PANDA: a plugin watches part of this page.  */
+    if (unlikely(tlb_addr & TLB_PANDA_WATCH)) {
+        if (!ENV_GET_CPU(env)->panda_in_mem_watch) {
+            return glue(helper_le_ld_name, _watched)(env, addr, oi, retaddr);
+        }
+        tlb_addr &= ~TLB_PANDA_WATCH;
+    }
+#endif
+
     /* Handle an IO access.  */
     if (unlikely(tlb_addr & ~TARGET_PAGE_MASK)) {
         if ((addr & (DATA_SIZE - 1)) != 0) {
@@ -173,6 +213,36 @@ WORD_TYPE helper_le_ld_name(CPUArchState *env, target_ulong addr,
 }
 
 #if DATA_SIZE > 1
+#ifndef SOFTMMU_CODE_ACCESS
+/* PANDA: report a load from a page holding a watched range to the
+   range-watching memory callbacks around doing it.  */
+static WORD_TYPE glue(helper_be_ld_name, _watched)(CPUArchState *env,
+                                                   target_ulong addr,
+                                                   TCGMemOpIdx oi,
+                                                   uintptr_t retaddr)
+{
+    unsigned mmu_idx = get_mmuidx(oi);
+    int index = (addr >> TARGET_PAGE_BITS) & (CPU_TLB_SIZE - 1);
+    target_ulong tlb_addr = env->tlb_table[mmu_idx][index].addr_read;
+    CPUState *cpu = ENV_GET_CPU(env);
+    uintptr_t haddr = 0;
+    WORD_TYPE res;
+
+    if ((addr & TARGET_PAGE_MASK) == (tlb_addr & ~TLB_PANDA_WATCH)) {
+        haddr = addr + env->tlb_table[mmu_idx][index].addend;
+    }
+
+    panda_callbacks_mem_watch(cpu, false, false, addr, DATA_SIZE, 0,
+                              (void *)haddr);
+    cpu->panda_in_mem_watch = true;
+    res = helper_be_ld_name(env, addr, oi, retaddr);
+    cpu->panda_in_mem_watch = false;
+    panda_callbacks_mem_watch(cpu, false, true, addr, DATA_SIZE, (uint64_t)res,
+                              (void *)haddr);
+    return res;
+}
+#endif
+
 WORD_TYPE helper_be_ld_name(CPUArchState *env, target_ulong addr,
                             TCGMemOpIdx oi, uintptr_t retaddr)
 {
@@ -198,6 +268,16 @@ WORD_TYPE helper_be_ld_name(CPUArchState *env, target_ulong addr,
         tlb_addr = env->tlb_table[mmu_idx][index].ADDR_READ;
     }
 
+#ifndef SOFTMMU_CODE_ACCESS
+    /* PANDA: a plugin watches part of this page.  */
+    if (unlikely(tlb_addr & TLB_PANDA_WATCH)) {
+        if (!ENV_GET_CPU(env)->panda_in_mem_watch) {
+            return glue(helper_be_ld_name, _watched)(env, addr, oi, retaddr);
+        }
+        tlb_addr &= ~TLB_PANDA_WATCH;
+    }
+#endif
+
     /* Handle an IO access.  */
     if (unlikely(tlb_addr & ~TARGET_PAGE_MASK)) {
         if ((addr & (DATA_SIZE - 1)) != 0) {
@@ -266,6 +346,31 @@ static inline void glue(io_write, SUFFIX)(CPUArchState *env,
     return io_writex(env, iotlbentry, val, addr, retaddr, DATA_SIZE);
 }
 
+/* PANDA: report a store to a page holding a watched range to the
+   range-watching memory callbacks around doing it.  */
+static void glue(helper_le_st_name, _watched)(CPUArchState *env,
+                                              target_ulong addr, DATA_TYPE val,
+                                              TCGMemOpIdx oi, uintptr_t retaddr)
+{
+    unsigned mmu_idx = get_mmuidx(oi);
+    int index = (addr >> TARGET_PAGE_BITS) & (CPU_TLB_SIZE - 1);
+    target_ulong tlb_addr = env->tlb_table[mmu_idx][index].addr_write;
+    CPUState *cpu = ENV_GET_CPU(env);
+    uintptr_t haddr = 0;
+
+    if ((addr & TARGET_PAGE_MASK) == (tlb_addr & ~TLB_PANDA_WATCH)) {
+        haddr = addr + env->tlb_table[mmu_idx][index].addend;
+    }
+
+    panda_callbacks_mem_watch(cpu, true, false, addr, DATA_SIZE, (uint64_t)val,
+                              (void *)haddr);
+    cpu->panda_in_mem_watch = true;
+    helper_le_st_name(env, addr, val, oi, retaddr);
+    cpu->panda_in_mem_watch = false;
+    panda_callbacks_mem_watch(cpu, true, true, addr, DATA_SIZE, (uint64_t)val,
+                              (void *)haddr);
+}
+
 void helper_le_st_name(CPUArchState *env, target_ulong addr, DATA_TYPE val,
                        TCGMemOpIdx oi, uintptr_t retaddr)
 {
@@ -289,6 +394,15 @@ void helper_le_st_name(CPUArchState *env, target_ulong addr, DATA_TYPE val,
         tlb_addr = env->tlb_table[mmu_idx][index].addr_write;
     }
 
+    /* PANDA: a plugin watches part of this page.  */
+    if (unlikely(tlb_addr & TLB_PANDA_WATCH)) {
+        if (!ENV_GET_CPU(env)->panda_in_mem_watch) {
+            glue(helper_le_st_name, _watched)(env, addr, val, oi, retaddr);
+            return;
+        }
+        tlb_addr &= ~TLB_PANDA_WATCH;
+    }
+
     /* Handle an IO access.  */
     if (unlikely(tlb_addr & ~TARGET_PAGE_MASK)) {
         if ((addr & (DATA_SIZE - 1)) != 0) {
@@ -342,6 +456,31 @@ void helper_le_st_name(CPUArchState *env, target_ulong addr, DATA_TYPE val,
 }
 
 #if DATA_SIZE > 1
+/* PANDA: report a store to a page holding a watched range to the
+   range-watching memory callbacks around doing it.  */
+static void glue(helper_be_st_name, _watched)(CPUArchState *env,
+                                              target_ulong addr, DATA_TYPE val,
+                                              TCGMemOpIdx oi, uintptr_t retaddr)
+{
+    unsigned mmu_idx = get_mmuidx(oi);
+    int index = (addr >> TARGET_PAGE_BITS) & (CPU_TLB_SIZE - 1);
+    target_ulong tlb_addr = env->tlb_table[mmu_idx][index].addr_write;
+    CPUState *cpu = ENV_GET_CPU(env);
+    uintptr_t haddr = 0;
+
+    if ((addr & TARGET_PAGE_MASK) == (tlb_addr & ~TLB_PANDA_WATCH)) {
+        haddr = addr + env->tlb_table[mmu_idx][index].addend;
+    }
+
+    panda_callbacks_mem_watch(cpu, true, false, addr, DATA_SIZE, (uint64_t)val,
+                              (void *)haddr);
+    cpu->panda_in_mem_watch = true;
+    helper_be_st_name(env, addr, val, oi, retaddr);
+    cpu->panda_in_mem_watch = false;
+    panda_callbacks_mem_watch(cpu, true, true, addr, DATA_SIZE, (uint64_t)val,
+                              (void *)haddr);
+}
+
 void helper_be_st_name(CPUArchState *env, target_ulong addr, DATA_TYPE val,
                        TCGMemOpIdx oi, uintptr_t retaddr)
 {
@@ -365,6 +504,15 @@ void helper_be_st_name(CPUArchState *env, target_ulong addr, DATA_TYPE val,
         tlb_addr = env->tlb_table[mmu_idx][index].addr_write;
     }
 
+    /* PANDA: a plugin watches part of this page.  */
+    if (unlikely(tlb_addr & TLB_PANDA_WATCH)) {
+        if (!ENV_GET_CPU(env)->panda_in_mem_watch) {
+            glue(helper_be_st_name, _watched)(env, addr, val, oi, retaddr);
+            return;
+        }
+        tlb_addr &= ~TLB_PANDA_WATCH;
+    }
+
     /* Handle an IO access.  */
     if (unlikely(tlb_addr & ~TARGET_PAGE_MASK)) {
         if ((addr & (DATA_SIZE - 1)) != 0) {
@@ -435,6 +583,7 @@ WORD_TYPE glue(helper_le_ld_name, _panda)(CPUArchState *env, target_ulong addr,
     if (execute_llvm && (retaddr == 0xDEADBEEF)){
         retaddr = GETPC();
     }
+    cpu->panda_mem_retaddr = retaddr;
 
     panda_callbacks_before_mem_read(cpu, cpu->panda_guest_pc, addr, DATA_SIZE, (void *)haddr);
     WORD_TYPE ret = helper_le_ld_name(env, addr, oi, retaddr);
@@ -464,6 +613,7 @@ void glue(helper_le_st_name, _panda)(CPUArchState *env, target_ulong addr,
     if (execute_llvm && (retaddr == 0xDEADBEEF)){
         retaddr = GETPC();
     }
+    cpu->panda_mem_retaddr = retaddr;
 
     panda_callbacks_before_mem_write(cpu, cpu->panda_guest_pc, addr, DATA_SIZE, (uint64_t)val, (void *)haddr);
     helper_le_st_name(env, addr, val, oi, retaddr);
@@ -492,6 +642,7 @@ WORD_TYPE glue(helper_be_ld_name, _panda)(CPUArchState *env, target_ulong addr,
     if (execute_llvm && (retaddr == 0xDEADBEEF)){
         retaddr = GETPC();
     }
+    cpu->panda_mem_retaddr = retaddr;
 
     panda_callbacks_before_mem_read(cpu, cpu->panda_guest_pc, addr, DATA_SIZE, (void *)haddr);
     WORD_TYPE ret = helper_be_ld_name(env, addr, oi, retaddr);
@@ -521,6 +672,7 @@ void glue(helper_be_st_name, _panda)(CPUArchState *env, target_ulong addr,
     if (execute_llvm && (retaddr == 0xDEADBEEF)){
         retaddr = GETPC();
     }
+    cpu->panda_mem_retaddr = retaddr;
 
     panda_callbacks_before_mem_write(cpu, cpu->panda_guest_pc, addr, DATA_SIZE, (uint64_t)val, (void *)haddr);
     helper_be_st_name(env, addr, val, oi, retaddr);
@@ -8522,8 +8522,8 @@ generate_debug:
 
 #ifdef CONFIG_SOFTMMU
         //mz let's count this instruction
-        // In LLVM mode we generate this more efficiently.
-        if ((rr_mode != RR_OFF || panda_update_pc) && !generate_llvm) {
+        // The LLVM code skips these ops and generates its own.
+        if (rr_mode != RR_OFF || panda_update_pc) {
             gen_op_update_panda_pc(pc_ptr);
             gen_op_update_rr_icount();
         }
@@ -7286,8 +7286,8 @@ void gen_intermediate_code(CPUPPCState *env, struct TranslationBlock *tb)
 
 #ifdef CONFIG_SOFTMMU
         //mz let's count this instruction
-        // In LLVM mode we generate this more efficiently.
-        if (rr_mode != RR_OFF && !generate_llvm) {
+        // The LLVM code skips these ops and generates its own.
+        if (rr_mode != RR_OFF) {
             gen_op_update_panda_pc(ctx.nip);
             gen_op_update_rr_icount();
         }
@@ -318,7 +318,7 @@ static int cpu_restore_state_from_tb(CPUState *cpu, TranslationBlock *tb,
 
 #if defined(CONFIG_LLVM)
     target_ulong guest_pc = cpu->panda_guest_pc;
-    if (execute_llvm) {
+    if (executing_llvm) {
         assert(guest_pc >= tb->pc);
         assert(guest_pc < tb->pc + tb->size);
         for (i = 0; i < num_insns; ++i) {
@@ -1321,6 +1321,9 @@ TranslationBlock *tb_gen_code(CPUState *cpu,
     if (use_icount && !(cflags & CF_IGNORE_ICOUNT)) {
         cflags |= CF_USE_ICOUNT;
     }
+    if (rr_mode == RR_REPLAY) {
+        cflags |= CF_RR_CHAIN_CHECK;
+    }
 
     tb = tb_alloc(pc);
     if (unlikely(!tb)) {
@@ -1429,7 +1432,10 @@ TranslationBlock *tb_gen_code(CPUState *cpu,
     if (generate_llvm) {
         for (i = 0; i < tcg_ctx.tb_ctx.nb_tbs; i++) {
             TranslationBlock *other = &tcg_ctx.tb_ctx.tbs[i];
-            if (tb == other) continue;
+            // Identical TBs share code from the LLVM code cache.
+            if (tb == other || tb->llvm_function == other->llvm_function) {
+                continue;
+            }
             if (other->llvm_tc_ptr <= tb->llvm_tc_ptr &&
                     tb->llvm_tc_ptr < other->llvm_tc_end) {
                 assert(false && "Allocating apparently overlapping blocks!");
@@ -1758,7 +1764,7 @@ static TranslationBlock *tb_find_pc(uintptr_t tc_ptr)
     }
 
 #ifdef CONFIG_LLVM
-    if (execute_llvm) {
+    if (executing_llvm) {
         /* first check last tb. optimization for coming from generated code. */
         tb = tcg_llvm_runtime.last_tb;
         if (tb && tb->llvm_function
@@ -713,6 +713,14 @@ void aio_context_setup(AioContext *ctx)
 #endif
 }
 
+void aio_context_forget_epoll(AioContext *ctx)
+{
+#ifdef CONFIG_EPOLL_CREATE1
+    /* Closing our copy leaves the epoll instance to whoever else holds it. */
+    aio_epoll_disable(ctx);
+#endif
+}
+
 void aio_context_set_poll_params(AioContext *ctx, int64_t max_ns,
                                  int64_t grow, int64_t shrink, Error **errp)
 {
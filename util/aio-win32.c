@@ -400,6 +400,10 @@ void aio_context_setup(AioContext *ctx)
 {
 }
 
+void aio_context_forget_epoll(AioContext *ctx)
+{
+}
+
 void aio_context_set_poll_params(AioContext *ctx, int64_t max_ns,
                                  int64_t grow, int64_t shrink, Error **errp)
 {
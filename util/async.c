@@ -25,6 +25,7 @@
 
 #include "qemu/osdep.h"
 #include "qapi/error.h"
+#include "qemu/error-report.h"
 #include "qemu-common.h"
 #include "block/aio.h"
 #include "block/thread-pool.h"
@@ -435,6 +436,31 @@ fail:
     return NULL;
 }
 
+void aio_context_after_fork(AioContext *ctx)
+{
+    aio_context_forget_epoll(ctx);
+
+    /* Unregistering only touches our own ppoll set now. */
+    aio_set_event_notifier(ctx, &ctx->notifier, false, NULL, NULL);
+    event_notifier_cleanup(&ctx->notifier);
+    if (event_notifier_init(&ctx->notifier, false) < 0) {
+        error_report("Failed to initialize event notifier after fork");
+        abort();
+    }
+    aio_set_event_notifier(ctx, &ctx->notifier,
+                           false,
+                           (EventNotifierHandler *)
+                           event_notifier_dummy_cb,
+                           event_notifier_poll);
+
+    /* The workers are gone; leak the pool rather than wait for them. */
+    ctx->thread_pool = NULL;
+#ifdef CONFIG_LINUX_AIO
+    /* Kernel AIO contexts are not inherited either. */
+    ctx->linux_aio = NULL;
+#endif
+}
+
 void aio_co_schedule(AioContext *ctx, Coroutine *co)
 {
     trace_aio_co_schedule(ctx, co);
@@ -170,6 +170,12 @@ int qemu_init_main_loop(Error **errp)
     return 0;
 }
 
+void qemu_main_loop_after_fork(void)
+{
+    aio_context_after_fork(qemu_aio_context);
+    aio_context_after_fork(iohandler_get_aio_context());
+}
+
 static int max_priority;
 
 #ifndef _WIN32
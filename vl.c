@@ -154,9 +154,12 @@ void panda_set_os_name(char *os_name);
 extern void panda_callbacks_after_machine_init(void);
 
 extern void pandalog_cc_init_write(const char * fname); 
+extern bool pandalog_cc_set_codec(const char *spec);
 int pandalog = 0;
 int panda_in_main_loop = 0;
 extern bool panda_abort_requested;
+extern volatile sig_atomic_t checkpoint_fork_requested;
+extern void panda_checkpoint_do_fork(void);
 
 #include "panda/debug.h"
 #include "panda/rr/rr_log_all.h"
@@ -1985,6 +1988,10 @@ static void main_loop(void)
             sigprocmask(SIG_SETMASK, &oldset, NULL);
         }
 
+        if (__builtin_expect(checkpoint_fork_requested, 0)) {
+            panda_checkpoint_do_fork();
+        }
+
         //mz 05.2012 We have the global mutex here, so this should be OK.
         if (rr_end_record_requested && rr_in_record()) {
             rr_do_end_record();
@@ -4210,9 +4217,21 @@ int main(int argc, char **argv, char **envp)
                 pandalog_cc_init_write(optarg);
                 printf ("pandalogging to [%s]\n", optarg);
                 break;
+            case QEMU_OPTION_pandalog_codec:
+                if (!pandalog_cc_set_codec(optarg)) {
+                    error_report("invalid pandalog codec '%s'", optarg);
+                    exit(1);
+                }
+                break;
             case QEMU_OPTION_record_from:
                 record_name = optarg;
                 break;
+            case QEMU_OPTION_rr_compress:
+                rr_log_compress = true;
+                break;
+            case QEMU_OPTION_rr_background_snapshot:
+                rr_snapshot_background = true;
+                break;
             case QEMU_OPTION_panda_arg:
                 // panda_add_arg() currently always return true
                 assert(panda_add_arg(NULL, optarg));